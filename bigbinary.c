@@ -1,71 +1,121 @@
-#include "bigbinary.h"
+#include "bigbinary_interne.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+/**
+ * bb_creer - Crée un BigBinary de nbMots mots à zéro
+ *
+ * RÔLE : Point d'entrée unique des allocations de résultats :
+ *   - nbMots ≤ BIGBINARY_MOTS_INTERNES → stockage interne, aucun malloc
+ *   - sinon → tableau alloué avec bb_allouer (tas ou arène)
+ *
+ * @param nbMots : Nombre de mots voulus (au moins 1)
+ * @return : BigBinary de Taille = nbMots, tous les mots à 0 (non normalisé)
+ */
+BigBinary bb_creer(int nbMots) {
+    BigBinary A;
+    if (nbMots < 1) nbMots = 1;
+
+    A.Taille = nbMots;
+    A.Signe  = 0;
+    A.NbBits = 0;
+    A.Normalise = 0;  // L'appelant va remplir les mots
+    memset(A.Interne, 0, sizeof(A.Interne));
+
+    if (nbMots <= BIGBINARY_MOTS_INTERNES) {
+        A.Tdigits  = NULL;
+        A.Capacite = BIGBINARY_MOTS_INTERNES;
+    } else {
+        A.Tdigits  = (uint64_t*)bb_allouerZero((size_t)nbMots * sizeof(uint64_t));
+        A.Capacite = nbMots;
+    }
+    return A;
+}
+
+/**
+ * bb_reserver - Garantit au moins nbMots mots de capacité
+ *
+ * RÔLE : Utilisé par les opérations "en place" qui font grandir le nombre.
+ *   Les Taille mots existants sont conservés ; la capacité double au moins
+ *   pour que des agrandissements répétés restent rares.
+ *
+ * @param A : Le BigBinary à agrandir
+ * @param nbMots : Capacité minimale voulue
+ */
+void bb_reserver(BigBinary *A, int nbMots) {
+    if (nbMots <= A->Capacite) return;
+
+    int cap = 2 * A->Capacite;
+    if (cap < nbMots) cap = nbMots;
+
+    uint64_t *nouveau = (uint64_t*)bb_allouer((size_t)cap * sizeof(uint64_t));
+    memcpy(nouveau, bb_mots(A), (size_t)A->Taille * sizeof(uint64_t));
+
+    bb_liberer(A->Tdigits);  // NULL si on quitte le stockage interne
+    A->Tdigits = nouveau;
+    A->Capacite = cap;
+}
+
 /**
  * normalizeBigBinary - Normalise un nombre binaire
  *
  * RÔLE : Cette fonction "nettoie" un BigBinary en :
- *   1. Supprimant les zéros de tête (MSB = Most Significant Bit)
- *   2. Gérant le cas spécial du zéro (un seul bit à 0)
+ *   1. Supprimant les mots nuls de tête (côté poids fort)
+ *   2. Gérant le cas spécial du zéro (un seul mot à 0)
+ *   3. Calculant le nombre de bits significatifs (NbBits)
  *
- * EXEMPLE : "00001101" devient "1101"
- *           "00000000" devient "0"
+ * Aucune réallocation : on ajuste seulement Taille, la capacité est
+ * conservée pour les calculs suivants. Si le nombre est déjà marqué
+ * normalisé, il n'y a rien à faire (O(1)).
+ *
+ * EXEMPLE : mots [0x0D, 0, 0] (poids faible en premier) deviennent [0x0D]
+ *           mots [0, 0] deviennent [0]
  *
  *
  * @param A : Pointeur vers le BigBinary à normaliser
  */
-static void normalizeBigBinary(BigBinary *A) {
+void normalizeBigBinary(BigBinary *A) {
     // Vérification de sécurité : pointeur NULL
     if (A == NULL) return;
 
+    // CAS 0 : Déjà normalisé → rien à faire
+    if (A->Normalise) return;
+
+    BB_STAT_COMPTER(BB_PRIM_NORMALISE, A->Taille);
+
     // CAS 1 : Structure vide ou invalide → transformer en zéro canonique
-    if (A->Tdigits == NULL || A->Taille <= 0) {
+    if (A->Taille <= 0) {
         // Libère (par sécurité) l'ancien tableau, même si NULL
-        free(A->Tdigits);
+        bb_liberer(A->Tdigits);
 
-        // On réalloue un seul entier = 0
-        A->Tdigits = (int*)malloc(sizeof(int));
-        A->Tdigits[0] = 0;
+        // Le zéro tient toujours dans le stockage interne
+        A->Tdigits = NULL;
+        A->Capacite = BIGBINARY_MOTS_INTERNES;
+        A->Interne[0] = 0;
         A->Taille = 1;
         A->Signe = 0;  // 0 est toujours positif
+        A->NbBits = 0;
+        A->Normalise = 1;
         return;
     }
 
-    // CAS 2 : Trouver le premier bit non nul (en partant du MSB/gauche)
-    // On cherche où commence vraiment le nombre
-    int i = 0;
-    while (i < A->Taille - 1 && A->Tdigits[i] == 0)
-        i++;
+    // CAS 2 : Trouver le premier mot non nul (en partant du poids fort)
+    // Les mots nuls de tête sont simplement retirés de la taille
+    uint64_t *m = bb_mots(A);
+    while (A->Taille > 1 && m[A->Taille - 1] == 0)
+        A->Taille--;
 
-    // CAS 3 : Si tous les bits sont à 0 → zéro canonique
-    if (i == A->Taille - 1 && A->Tdigits[i] == 0) {
-        // On libère et on force la représentation canonique
-        free(A->Tdigits);
-        A->Tdigits = (int*)malloc(sizeof(int));
-        A->Tdigits[0] = 0;
-        A->Taille = 1;
+    // CAS 3 : Si tous les mots sont à 0 → zéro canonique (positif)
+    if (A->Taille == 1 && m[0] == 0) {
         A->Signe = 0;
-        return;
+        A->NbBits = 0;
+    } else {
+        // Le mot de tête est non nul : ses zéros de tête donnent la longueur
+        A->NbBits = A->Taille * BB_BITS_MOT - bb_clz64(m[A->Taille - 1]);
     }
 
-    // CAS 4 : Il y a des zéros de tête à supprimer
-    // Exemple : [0,0,1,0,1] → [1,0,1]
-    if (i > 0) {
-        int newLen = A->Taille - i;  // Nouvelle taille
-        int *nd = (int*)malloc(newLen * sizeof(int));
-
-        // Copier uniquement la partie utile (à partir de l'indice i)
-        memcpy(nd, A->Tdigits + i, newLen * sizeof(int));
-
-        // Libérer l'ancien tableau et utiliser le nouveau
-        free(A->Tdigits);
-
-        // met à jour la structure
-        A->Tdigits = nd;
-        A->Taille = newLen;
-    }
+    A->Normalise = 1;
 
     // CONVENTION : Le zéro est toujours positif (déjà géré ci-dessus)
 }
@@ -82,18 +132,16 @@ static void normalizeBigBinary(BigBinary *A) {
  * RÔLE : Initialise un nombre binaire à sa valeur par défaut : 0
  *
  * STRUCTURE BigBinary :
- *   - Tdigits : tableau de bits (0 ou 1)
- *   - Taille : nombre de bits
+ *   - Tdigits / Interne : mots de 64 bits (poids faible en premier)
+ *   - Taille : nombre de mots
  *   - Signe : 0 = positif, 1 = négatif
  *
- * @return : Un BigBinary représentant 0 (un seul bit à 0)
+ * @return : Un BigBinary représentant 0 (un seul mot à 0, sans allocation)
  */
 BigBinary initBigBinary() {
-    BigBinary A;
-    A.Tdigits = (int*)malloc(sizeof(int));  // Alloue 1 int
-    A.Tdigits[0] = 0;                        // Met le bit à 0
-    A.Taille = 1;                            // Taille = 1 bit
-    A.Signe  = 0;                            // Positif
+    // Un seul mot à 0, dans le stockage interne : aucune allocation
+    BigBinary A = bb_creer(1);
+    A.Normalise = 1;  // Zéro canonique : NbBits = 0
     return A;
 }
 
@@ -150,16 +198,16 @@ BigBinary initBigBinaryFromString(const char *str) {
     }
 
     // CAS 5 : Créer le BigBinary avec les chiffres trouvés
-    BigBinary A;
-    A.Taille  = count;
-    A.Signe   = signe;
-    A.Tdigits = (int*)malloc(A.Taille * sizeof(int));
+    BigBinary A = bb_creer((count + BB_BITS_MOT - 1) / BB_BITS_MOT);
+    A.Signe = signe;
+    uint64_t *m = bb_mots(&A);
 
-    // Remplir le tableau avec les bits (0 ou 1)
+    // Remplir les mots : le k-ième chiffre lu (MSB en premier) est le bit count-1-k
     int k = 0;
     for (int i = i0; str[i] != '\0'; ++i) {
         if (str[i] == '0' || str[i] == '1') {
-            A.Tdigits[k++] = (str[i] == '1') ? 1 : 0;
+            int pos = count - 1 - k++;
+            if (str[i] == '1') m[pos / BB_BITS_MOT] |= 1ULL << (pos % BB_BITS_MOT);
         }
     }
 
@@ -182,9 +230,11 @@ void afficheBigBinary(const BigBinary A) {
     // Afficher le signe si négatif
     if (A.Signe) printf("-");
 
-    // Afficher chaque bit
-    for (int i = 0; i < A.Taille; ++i) {
-        printf("%d", A.Tdigits[i]);
+    // Afficher chaque bit, du poids fort au poids faible
+    int bits = BigBinary_nbBits(A);
+    if (bits == 0) printf("0");
+    for (int i = bits - 1; i >= 0; --i) {
+        printf("%d", bb_bit(&A, i));
     }
     printf("\n");
 }
@@ -202,13 +252,16 @@ void afficheBigBinary(const BigBinary A) {
 void libereBigBinary(BigBinary *A) {
     if (!A) return;  // Sécurité : pointeur NULL
 
-    // Libérer le tableau de bits
-    if (A->Tdigits) free(A->Tdigits);
+    // Libérer le tableau de mots (rien à faire en stockage interne)
+    if (A->Tdigits) bb_liberer(A->Tdigits);
 
     // Réinitialiser la structure
-    A->Tdigits = NULL;
-    A->Taille  = 0;
-    A->Signe   = 0;
+    A->Tdigits  = NULL;
+    A->Taille   = 0;
+    A->Signe    = 0;
+    A->Capacite = 0;
+    A->NbBits   = 0;
+    A->Normalise = 0;
 }
 
 /**
@@ -221,21 +274,25 @@ void libereBigBinary(BigBinary *A) {
  * LOGIQUE :
  *   1. Si tailles différentes → pas égaux
  *   2. Si signes différents → pas égaux
- *   3. Comparer bit par bit
+ *   3. Comparer mot par mot
  *
  * @param A, B : Les BigBinary à comparer
  * @return : 1 si égaux, 0 sinon
  */
 int Egal(const BigBinary A, const BigBinary B) {
+    BB_STAT_COMPTER(BB_PRIM_CMP, A.Taille);
+
     // Test 1 : Tailles différentes
     if (A.Taille != B.Taille) return 0;
 
     // Test 2 : Signes différents
     if (A.Signe  != B.Signe)  return 0;
 
-    // Test 3 : Comparer chaque bit
+    // Test 3 : Comparer chaque mot
+    const uint64_t *a = bb_motsC(&A);
+    const uint64_t *b = bb_motsC(&B);
     for (int i = 0; i < A.Taille; ++i) {
-        if (A.Tdigits[i] != B.Tdigits[i]) return 0;
+        if (a[i] != b[i]) return 0;
     }
 
     return 1;  // Tous les tests passés → égaux
@@ -247,30 +304,49 @@ int Egal(const BigBinary A, const BigBinary B) {
  * RÔLE : Compare deux nombres binaires comme des entiers positifs
  *
  * ALGORITHME :
- *   1. Plus court → plus petit (101 < 1011)
- *   2. Même taille → comparer bit par bit de gauche à droite (MSB first)
+ *   1. Moins de mots → plus petit
+ *   2. Même taille → comparer mot par mot en partant du poids fort
  *
  * EXEMPLE :
- *   1010 < 1100 ? → compare MSB : 1==1, puis 0<1 → OUI
- *   111 < 1000 ? → tailles : 3<4 → OUI
+ *   1010 < 1100 ? → même mot, 0b1010 < 0b1100 → OUI
+ *   2^64 < 2^65 ? → mots de poids fort comparés : 1<2 → OUI
+ *
+ * (simple test sur BigBinary_cmp, qui fait le parcours)
  *
  * @param A, B : Les BigBinary à comparer
  * @return : 1 si A < B, 0 sinon
  */
 int Inferieur(const BigBinary A, const BigBinary B) {
-    // Cas 1 : A a moins de bits → A < B
-    if (A.Taille < B.Taille) return 1;
-
-    // Cas 2 : A a plus de bits → A > B
-    if (A.Taille > B.Taille) return 0;
+    return BigBinary_cmp(A, B) < 0;
+}
 
-    // Cas 3 : Même taille → comparer bit par bit (MSB first)
-    for (int i = 0; i < A.Taille; ++i) {
-        if (A.Tdigits[i] < B.Tdigits[i]) return 1;  // A < B
-        if (A.Tdigits[i] > B.Tdigits[i]) return 0;  // A > B
+/**
+ * BigBinary_cmp - Comparaison à trois issues (non signée)
+ *
+ * RÔLE : Un seul parcours là où les appelants enchaînaient Inferieur et
+ *   Egal sur la même paire (chacun reparcourait tous les mots)
+ *
+ * ALGORITHME :
+ *   1. Moins de mots significatifs → plus petit
+ *   2. Même nombre → premier mot différent en partant du poids fort
+ *
+ * @param A, B : Les BigBinary à comparer (signes ignorés)
+ * @return : -1 si A < B, 0 si A = B, 1 si A > B
+ */
+int BigBinary_cmp(const BigBinary A, const BigBinary B) {
+    BB_STAT_COMPTER(BB_PRIM_CMP, A.Taille);
+
+    // Cas 1 : Longueurs différentes (mots nuls de tête ignorés)
+    int na = bb_motsUtiles(&A), nb = bb_motsUtiles(&B);
+    if (na != nb) return (na < nb) ? -1 : 1;
+
+    // Cas 2 : Même longueur → mot par mot, poids fort d'abord
+    const uint64_t *a = bb_motsC(&A);
+    const uint64_t *b = bb_motsC(&B);
+    for (int i = na - 1; i >= 0; --i) {
+        if (a[i] != b[i]) return (a[i] < b[i]) ? -1 : 1;
     }
-
-    return 0;  // Égaux → A n'est pas < B
+    return 0;
 }
 
 /**
@@ -279,9 +355,10 @@ int Inferieur(const BigBinary A, const BigBinary B) {
  * RÔLE : Calcule A + B en binaire (comme addition de nombres positifs)
  *
  * ALGORITHME : Addition classique avec retenue (carry)
- *   - Parcours de droite à gauche (LSB → MSB)
- *   - À chaque position : bit_A + bit_B + retenue
- *   - Si résultat ≥ 2 : on garde le bit de poids faible et propage la retenue
+ *   - Parcours de droite à gauche (LSB → MSB), 64 bits à la fois
+ *   - À chaque position : mot_A + mot_B + retenue
+ *   - Si la somme dépasse 2^64 : on garde les 64 bits bas et propage la retenue
+ *   (c'est exactement l'addition bit à bit ci-dessous, faite par mots)
  *
  * EXEMPLE :
  *     1011 (11)
@@ -300,42 +377,41 @@ int Inferieur(const BigBinary A, const BigBinary B) {
  * @return : Résultat A + B (normalisé)
  */
 BigBinary additionBigBinary(const BigBinary A, const BigBinary B) {
-    // Déterminer la taille maximale
-    int n = (A.Taille > B.Taille) ? A.Taille : B.Taille;
+    BB_STAT_DEBUT(BB_PRIM_ADD);
 
-    // Créer le résultat (taille max + 1 pour la retenue finale)
-    BigBinary R;
+    // Déterminer la taille maximale (en mots)
+    int n = (A.Taille > B.Taille) ? A.Taille : B.Taille;
 
-    // On ajoute 1 bit pour stocker une éventuelle retenue finale
-    R.Taille  = n + 1;
-    R.Signe   = 0;  // Non signé en Phase 1
-    R.Tdigits = (int*)calloc(R.Taille, sizeof(int));  // Initialise à 0
+    // Créer le résultat : on ajoute 1 mot pour une éventuelle retenue finale
+    BigBinary R = bb_creer(n + 1);
+    R.Signe = 0;  // Non signé en Phase 1
 
-    int carry = 0;  // Retenue initiale
+    const uint64_t *a = bb_motsC(&A);
+    const uint64_t *b = bb_motsC(&B);
+    uint64_t *r = bb_mots(&R);
+    uint64_t carry = 0;  // Retenue initiale
 
     // Boucle de droite à gauche (LSB → MSB)
     for (int i = 0; i < n; ++i) {
-        // Récupérer le bit de A (ou 0 si hors bornes)
-        int abit = (A.Taille - 1 - i >= 0) ? A.Tdigits[A.Taille - 1 - i] : 0;
-
-        // Récupérer le bit de B (ou 0 si hors bornes)
-        int bbit = (B.Taille - 1 - i >= 0) ? B.Tdigits[B.Taille - 1 - i] : 0;
+        // Récupérer le mot de A et de B (ou 0 si hors bornes)
+        uint64_t amot = (i < A.Taille) ? a[i] : 0;
+        uint64_t bmot = (i < B.Taille) ? b[i] : 0;
 
-        // Addition : bit_A + bit_B + retenue
-        int sum = abit + bbit + carry;
+        // Addition : mot_A + mot_B + retenue (une retenue au plus)
+        uint64_t sum = amot + carry;
+        carry = (sum < carry);
+        sum += bmot;
+        carry += (sum < bmot);
 
-        // Le bit résultat est le bit de poids faible de sum
-        R.Tdigits[R.Taille - 1 - i] = sum & 1;  // sum % 2
-
-        // La retenue est le bit de poids fort de sum
-        carry = (sum >> 1);  // sum / 2
+        r[i] = sum;
     }
 
-    // Placer la retenue finale (MSB)
-    R.Tdigits[0] = carry;
+    // Placer la retenue finale (mot de poids fort)
+    r[n] = carry;
 
     // Normaliser (supprimer les zéros de tête)
     normalizeBigBinary(&R);
+    BB_STAT_FIN(BB_PRIM_ADD, n);
     return R;
 }
 
@@ -351,9 +427,9 @@ BigBinary additionBigBinary(const BigBinary A, const BigBinary B) {
  * PRÉCONDITION CRITIQUE : A >= B (sinon erreur)
  *
  * ALGORITHME : Soustraction classique avec emprunt (borrow)
- *   - Parcours de droite à gauche (LSB → MSB)
- *   - À chaque position : bit_A - bit_B - emprunt
- *   - Si résultat < 0 : on emprunte 2 et propage l'emprunt
+ *   - Parcours de droite à gauche (LSB → MSB), 64 bits à la fois
+ *   - À chaque position : mot_A - mot_B - emprunt
+ *   - Si résultat < 0 : on emprunte 2^64 et propage l'emprunt
  *
  * EXEMPLE :
  *     1011 (11)
@@ -371,48 +447,44 @@ BigBinary additionBigBinary(const BigBinary A, const BigBinary B) {
  * @return : Résultat A - B (normalisé)
  */
 BigBinary soustractionBigBinary(const BigBinary A, const BigBinary B) {
+    BB_STAT_DEBUT(BB_PRIM_SUB);
+
     // VÉRIFICATION : A doit être >= B
     if (Inferieur(A, B)) {
         fprintf(stderr, "ERREUR: A < B dans soustractionBigBinary (précondition non respectée)\n");
         return initBigBinary();  // Retourne 0 par défaut
     }
 
-    // Créer le résultat (même taille que A)
-    BigBinary R;
+    // Créer le résultat : il ne peut pas être plus long que A
+    BigBinary R = bb_creer(A.Taille);
+    R.Signe = 0;  // Non signé en Phase 1
 
-    // Le résultat ne peut pas être plus long que A
-    R.Taille  = A.Taille;
-    R.Signe   = 0;  // Non signé en Phase 1
-    R.Tdigits = (int*)calloc(R.Taille, sizeof(int));  // Initialise à 0
-
-    int borrow = 0;  // Emprunt initial
+    const uint64_t *a = bb_motsC(&A);
+    const uint64_t *b = bb_motsC(&B);
+    uint64_t *r = bb_mots(&R);
+    uint64_t borrow = 0;  // Emprunt initial
 
     // Boucle de droite à gauche (LSB → MSB)
     for (int i = 0; i < A.Taille; ++i) {
-        // Bit de A
-        int abit = A.Tdigits[A.Taille - 1 - i];
+        // Mot de B (ou 0 si hors bornes)
+        uint64_t bmot = (i < B.Taille) ? b[i] : 0;
 
-        // Bit de B (ou 0 si hors bornes)
-        int bbit = (B.Taille - 1 - i >= 0) ? B.Tdigits[B.Taille - 1 - i] : 0;
+        // Soustraction : mot_A - mot_B - emprunt
+        uint64_t diff = a[i] - bmot;
+        uint64_t b1 = (a[i] < bmot);
+        uint64_t b2 = (diff < borrow);
+        diff -= borrow;
 
-        // Soustraction : bit_A - bit_B - emprunt
-        int diff = abit - bbit - borrow;
+        // Propagation de l'emprunt (au plus un des deux)
+        borrow = b1 | b2;
 
-        // Si diff < 0, on emprunte 2 (en binaire)
-        if (diff < 0) {
-            diff += 2;      // diff devient 0 ou 1
-            borrow = 1;     // Propagation de l'emprunt
-        }
-        else {
-            borrow = 0;     // Pas d'emprunt
-        }
-
-        // Placer le bit résultat
-        R.Tdigits[R.Taille - 1 - i] = diff;
+        // Placer le mot résultat
+        r[i] = diff;
     }
 
     // Normaliser (supprimer les zéros de tête)
     normalizeBigBinary(&R);
+    BB_STAT_FIN(BB_PRIM_SUB, A.Taille);
     return R;
 }
 
@@ -426,13 +498,19 @@ BigBinary soustractionBigBinary(const BigBinary A, const BigBinary B) {
  *
  * RÔLE : Vérifie si tous les bits sont à 0
  *
+ * Sur un nombre normalisé, la longueur suffit (O(1)) ; sinon on parcourt
+ * les mots.
+ *
  * @param A : Le BigBinary à tester
  * @return : 1 si A == 0, 0 sinon
  */
 int estZero(const BigBinary A) {
-    // Parcourir tous les bits
+    if (A.Normalise) return A.NbBits == 0;
+
+    // Parcourir tous les mots
+    const uint64_t *a = bb_motsC(&A);
     for (int i = 0; i < A.Taille; ++i) {
-        if (A.Tdigits[i] != 0) return 0;  // Un bit non nul trouvé
+        if (a[i] != 0) return 0;  // Un mot non nul trouvé
     }
     return 1;  // Tous les bits sont à 0
 }
@@ -442,7 +520,7 @@ int estZero(const BigBinary A) {
  *
  * RÔLE : Un nombre est pair si son dernier bit (LSB) est 0
  *
- * FORMAT MSB-FIRST : Le LSB est le dernier élément du tableau
+ * FORMAT PAR MOTS : Le LSB est le bit 0 du premier mot
  *
  * EXEMPLE :
  *   1010 → LSB = 0 → pair
@@ -453,16 +531,17 @@ int estZero(const BigBinary A) {
  */
 int estPair(const BigBinary A) {
     // Sécurité
-    if (A.Taille <= 0 || A.Tdigits == NULL) return 1;
+    if (A.Taille <= 0) return 1;
 
-    // Le LSB est le dernier élément
-    return (A.Tdigits[A.Taille - 1] == 0);
+    // Le LSB est le bit de poids faible du mot 0
+    return (bb_motsC(&A)[0] & 1ULL) == 0;
 }
 
 /**
  * copieBigBinary - Crée une copie profonde d'un BigBinary
  *
- * RÔLE : Clone complètement un BigBinary (nouveau tableau alloué)
+ * RÔLE : Clone complètement un BigBinary (nouveau tableau alloué si le
+ *        nombre dépasse le stockage interne)
  *
  * IMPORTANT : L'appelant doit libérer la copie avec libereBigBinary()
  *
@@ -470,18 +549,63 @@ int estPair(const BigBinary A) {
  * @return : Une copie indépendante de A
  */
 BigBinary copieBigBinary(const BigBinary A) {
-    BigBinary C;
+    BigBinary C = bb_creer(A.Taille);
+    C.Signe = A.Signe;
+    C.NbBits = A.NbBits;
+    C.Normalise = A.Normalise;  // Une copie d'un nombre normalisé l'est aussi
 
-    C.Taille  = A.Taille;
-    C.Signe   = A.Signe;
+    // Copier tous les mots
+    memcpy(bb_mots(&C), bb_motsC(&A), (size_t)A.Taille * sizeof(uint64_t));
 
-    // Allouer un nouveau tableau
-    C.Tdigits = (int*)malloc(C.Taille * sizeof(int));
+    return C;
+}
 
-    // Copier tous les bits
-    memcpy(C.Tdigits, A.Tdigits, C.Taille * sizeof(int));
+/**
+ * motsDecalerGauche - Noyau du décalage à gauche sur les mots
+ *
+ * RÔLE : r = a << (64×q + s), avec a de na mots et r de na+q+1 mots
+ *
+ * PRINCIPE :
+ *   - les mots entiers (q) se déplacent d'un bloc (memmove)
+ *   - le reste (s < 64 bits) se fait en une passe : chaque mot du
+ *     résultat assemble le haut d'un mot de a et le bas du suivant
+ *
+ * Le parcours se fait du poids fort vers le poids faible : r peut donc
+ * être le même tableau que a (décalage en place).
+ */
+static void motsDecalerGauche(uint64_t *r, const uint64_t *a, int na, int q, int s) {
+    if (s == 0) {
+        memmove(r + q, a, (size_t)na * sizeof(uint64_t));
+        r[na + q] = 0;
+    } else {
+        r[na + q] = a[na - 1] >> (BB_BITS_MOT - s);
+        for (int i = na - 1; i > 0; --i) {
+            r[i + q] = (a[i] << s) | (a[i - 1] >> (BB_BITS_MOT - s));
+        }
+        r[q] = a[0] << s;
+    }
+    // Les q mots de poids faible sont à 0
+    memset(r, 0, (size_t)q * sizeof(uint64_t));
+}
 
-    return C;
+/**
+ * motsDecalerDroite - Noyau du décalage à droite sur les mots
+ *
+ * RÔLE : r = a >> (64×q + s), avec a de na mots (na > q) et r de na-q mots
+ *
+ * Le parcours se fait du poids faible vers le poids fort : r peut donc
+ * être le même tableau que a (décalage en place).
+ */
+static void motsDecalerDroite(uint64_t *r, const uint64_t *a, int na, int q, int s) {
+    int nr = na - q;
+    if (s == 0) {
+        memmove(r, a + q, (size_t)nr * sizeof(uint64_t));
+        return;
+    }
+    for (int i = 0; i < nr - 1; ++i) {
+        r[i] = (a[i + q] >> s) | (a[i + q + 1] << (BB_BITS_MOT - s));
+    }
+    r[nr - 1] = a[na - 1] >> s;
 }
 
 /**
@@ -495,8 +619,8 @@ BigBinary copieBigBinary(const BigBinary A) {
  *   decaleGauche(101, 2) = 10100
  *   101₂ × 2² = 5 × 4 = 20 = 10100₂
  *
- * DANS LE TABLEAU MSB-FIRST :
- *   [1,0,1] devient [1,0,1,0,0]
+ * DANS LES MOTS : n = 64×q + s → on déplace de q mots entiers, puis
+ *   on décale de s bits en une seule passe (voir motsDecalerGauche)
  *
  * @param A : Le BigBinary à décaler
  * @param n : Nombre de positions (bits) de décalage
@@ -506,27 +630,48 @@ BigBinary decaleGauche(const BigBinary A, int n) {
     // Cas triviaux : pas de décalage ou A = 0
     if (n <= 0 || estZero(A)) return copieBigBinary(A);
 
-    // Créer le résultat (taille augmentée de n)
-    BigBinary R;
-
-    // nouvelle taille = ancienne + n
-    R.Taille  = A.Taille + n;
-    R.Signe   = A.Signe;
+    BB_STAT_DEBUT(BB_PRIM_DECALAGE);
 
-    // allocation
-    R.Tdigits = (int*)malloc(R.Taille * sizeof(int));
+    // Créer le résultat (q mots de plus, + 1 pour les bits qui débordent)
+    int q = n / BB_BITS_MOT;
+    BigBinary R = bb_creer(A.Taille + q + 1);
+    R.Signe = A.Signe;
 
-    // Copier A au début (MSB)
-    memcpy(R.Tdigits, A.Tdigits, A.Taille * sizeof(int));
-
-    // Ajouter n zéros à la fin (LSB)
-    memset(R.Tdigits + A.Taille, 0, n * sizeof(int));
+    motsDecalerGauche(bb_mots(&R), bb_motsC(&A), A.Taille, q, n % BB_BITS_MOT);
 
     // nettoie
     normalizeBigBinary(&R);
+    BB_STAT_FIN(BB_PRIM_DECALAGE, A.Taille);
     return R;
 }
 
+/**
+ * decaleGaucheEnPlace - A = A << n, sans créer de nouveau BigBinary
+ *
+ * RÔLE : Même calcul que decaleGauche, mais dans le stockage de A
+ *   (agrandi si nécessaire). Pour les boucles qui décalent à chaque tour.
+ *
+ * @param A : Le BigBinary à décaler (modifié)
+ * @param n : Nombre de positions (bits) de décalage
+ */
+void decaleGaucheEnPlace(BigBinary *A, int n) {
+    if (A == NULL || n <= 0 || estZero(*A)) return;
+
+    BB_STAT_DEBUT(BB_PRIM_DECALAGE);
+
+    int q = n / BB_BITS_MOT;
+    int na = A->Taille;
+    bb_reserver(A, na + q + 1);
+
+    uint64_t *m = bb_mots(A);
+    motsDecalerGauche(m, m, na, q, n % BB_BITS_MOT);
+
+    A->Taille = na + q + 1;
+    A->Normalise = 0;
+    normalizeBigBinary(A);
+    BB_STAT_FIN(BB_PRIM_DECALAGE, na);
+}
+
 /**
  * decaleDroite - Décalage à droite de n positions (division par 2^n)
  *
@@ -538,8 +683,8 @@ BigBinary decaleGauche(const BigBinary A, int n) {
  *   decaleDroite(10110, 2) = 101
  *   10110₂ ÷ 2² = 22 ÷ 4 = 5 = 101₂
  *
- * DANS LE TABLEAU MSB-FIRST :
- *   [1,0,1,1,0] devient [1,0,1]
+ * DANS LES MOTS : n = 64×q + s → on saute q mots entiers, puis on
+ *   décale de s bits en une seule passe (voir motsDecalerDroite)
  *
  * @param A : Le BigBinary à décaler
  * @param n : Nombre de positions (bits) de décalage
@@ -549,27 +694,144 @@ BigBinary decaleDroite(const BigBinary A, int n) {
     // Cas trivial : pas de décalage
     if (n <= 0) return copieBigBinary(A);
 
-    // Si décalage >= taille → résultat = 0
-    if (n >= A.Taille) {
+    // Si décalage >= nombre de bits → résultat = 0
+    if (n >= BigBinary_nbBits(A)) {
         return initBigBinary();
     }
 
-    // Créer le résultat (taille réduite de n)
-    BigBinary R;
-    R.Taille  = A.Taille - n;
-    R.Signe   = A.Signe;
+    BB_STAT_DEBUT(BB_PRIM_DECALAGE);
 
-    // On alloue le tableau plus petit
-    R.Tdigits = (int*)malloc(R.Taille * sizeof(int));
+    // Créer le résultat (q mots de moins)
+    int q = n / BB_BITS_MOT;
+    BigBinary R = bb_creer(A.Taille - q);
+    R.Signe = A.Signe;
 
-    // Copier uniquement la partie MSB (on supprime les n derniers bits)
-    memcpy(R.Tdigits, A.Tdigits, R.Taille * sizeof(int));
+    motsDecalerDroite(bb_mots(&R), bb_motsC(&A), A.Taille, q, n % BB_BITS_MOT);
 
     // On normalise
     normalizeBigBinary(&R);
+    BB_STAT_FIN(BB_PRIM_DECALAGE, A.Taille);
     return R;
 }
 
+/**
+ * decaleDroiteEnPlace - A = A >> n, sans créer de nouveau BigBinary
+ *
+ * RÔLE : Même calcul que decaleDroite, dans le stockage de A
+ *   (aucune allocation)
+ *
+ * @param A : Le BigBinary à décaler (modifié)
+ * @param n : Nombre de positions (bits) de décalage
+ */
+void decaleDroiteEnPlace(BigBinary *A, int n) {
+    if (A == NULL || n <= 0) return;
+
+    BB_STAT_DEBUT(BB_PRIM_DECALAGE);
+
+    // Décalage >= nombre de bits → zéro (on garde le stockage)
+    if (n >= BigBinary_nbBits(*A)) {
+        bb_mots(A)[0] = 0;
+        A->Taille = 1;
+    } else {
+        int q = n / BB_BITS_MOT;
+        uint64_t *m = bb_mots(A);
+        motsDecalerDroite(m, m, A->Taille, q, n % BB_BITS_MOT);
+        A->Taille -= q;
+    }
+
+    A->Normalise = 0;
+    normalizeBigBinary(A);
+    BB_STAT_FIN(BB_PRIM_DECALAGE, A->Taille);
+}
+
+/**
+ * motsSoustraireAbs - r = |a - b| en une passe, retourne le signe de a - b
+ *
+ * RÔLE : Noyau de BigBinary_subAbs et des opérations signées : pas de
+ *   comparaison complète
+ *   suivie d'une soustraction (deux parcours), mais :
+ *   1. les mots de tête égaux sont sautés (ils donnent des zéros) ;
+ *   2. le premier mot de tête différent désigne le plus grand ;
+ *   3. une seule soustraction "plus grand - plus petit" sur le reste.
+ *   Sur des nombres quelconques, l'étape 1 s'arrête dès le premier mot.
+ *
+ * @param r : Résultat, max(na, nb) mots (peut être a ou b)
+ * @return : -1 si a < b, 0 si a = b, 1 si a > b
+ */
+static int motsSoustraireAbs(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb) {
+    int n = (na > nb) ? na : nb;
+    int inverse = 0;
+
+    // ÉTAPES 1 et 2 : longueur utile et plus grand des deux
+    if (na == nb) {
+        int m = na;
+        while (m > 0 && a[m - 1] == b[m - 1]) m--;
+        memset(r + m, 0, (size_t)(n - m) * sizeof(uint64_t));
+        if (m == 0) return 0;
+        inverse = (a[m - 1] < b[m - 1]);
+        na = nb = m;
+    } else {
+        inverse = (na < nb);
+    }
+
+    const uint64_t *x = inverse ? b : a;
+    const uint64_t *y = inverse ? a : b;
+    int nx = inverse ? nb : na;
+    int ny = inverse ? na : nb;
+
+    // ÉTAPE 3 : x - y, x ≥ y
+    uint64_t emprunt = 0;
+    for (int i = 0; i < nx; ++i) {
+        uint64_t ymot = (i < ny) ? y[i] : 0;
+        uint64_t d = x[i] - ymot;
+        uint64_t e1 = (x[i] < ymot);
+        uint64_t e2 = (d < emprunt);
+        r[i] = d - emprunt;
+        emprunt = e1 | e2;
+    }
+    return inverse ? -1 : 1;
+}
+
+/**
+ * BigBinary_subAbs - R = |A - B| et signe de A - B, en un seul parcours
+ *
+ * RÔLE : Remplace le couple "comparer puis soustraire" des boucles de
+ *   PGCD : le signe sort de la soustraction elle-même
+ *
+ * STOCKAGE : R doit être un BigBinary valide ; son tableau est réutilisé
+ *   s'il est assez grand (aucune allocation dans une boucle), sinon
+ *   remplacé après le calcul. R peut donc être A ou B.
+ *
+ * @param R : Résultat (modifié, normalisé, positif)
+ * @param A, B : Les BigBinary (signes ignorés)
+ * @return : -1 si A < B, 0 si A = B, 1 si A > B
+ */
+int BigBinary_subAbs(BigBinary *R, const BigBinary A, const BigBinary B) {
+    BB_STAT_DEBUT(BB_PRIM_SUB);
+
+    int na = bb_motsUtiles(&A), nb = bb_motsUtiles(&B);
+    int n = (na > nb) ? na : nb;
+
+    // Nouveau tableau seulement si R est trop petit ; l'ancien (peut-être
+    // celui de A ou B) n'est libéré qu'après la soustraction
+    BigBinary ancien = *R;
+    int remplace = (R->Capacite < n);
+    if (remplace) *R = bb_creer(n);
+
+    uint64_t *r = bb_mots(R);
+    int signe = motsSoustraireAbs(r, bb_motsC(&A), na, bb_motsC(&B), nb);
+    if (n == 0) r[0] = 0;
+
+    R->Taille = (n > 0) ? n : 1;
+    R->Signe = 0;
+    R->Normalise = 0;
+    normalizeBigBinary(R);
+    if (remplace) libereBigBinary(&ancien);
+
+    BB_STAT_FIN(BB_PRIM_SUB, n);
+    return signe;
+}
+
 /**
  * soustractionAbsolue - Calcule |A - B| (valeur absolue)
  *
@@ -578,17 +840,164 @@ BigBinary decaleDroite(const BigBinary A, int n) {
  * LOGIQUE :
  *   - Si A >= B → retourne A - B
  *   - Si A < B → retourne B - A
+ *   (le sens est trouvé pendant la soustraction, voir BigBinary_subAbs)
  *
  * @param A, B : Les BigBinary
  * @return : |A - B| (toujours positif)
  */
 BigBinary soustractionAbsolue(const BigBinary A, const BigBinary B) {
-    // Si A < B → on retourne (B - A)
-    if (Inferieur(A, B)) {
-        return soustractionBigBinary(B, A);  // B - A
+    BigBinary R = initBigBinary();
+    BigBinary_subAbs(&R, A, B);
+    return R;
+}
+
+/* ===========================================================
+ *  ARITHMÉTIQUE SIGNÉE
+ *  Signe + valeur absolue : Signe = 1 pour un nombre négatif,
+ *  le zéro est toujours positif (voir normalizeBigBinary)
+ * =========================================================== */
+
+/**
+ * combinerSigne - (±|A|) + (±|B|), signes donnés à part
+ *
+ * Mêmes signes : addition des valeurs absolues, signe commun.
+ * Signes opposés : |A| - |B| en une passe, le signe vient de A et du
+ * sens de la soustraction.
+ */
+static BigBinary combinerSigne(const BigBinary *A, int signeA, const BigBinary *B, int signeB) {
+    int na = bb_motsUtiles(A), nb = bb_motsUtiles(B);
+    int n = (na > nb) ? na : nb;
+    BigBinary R = bb_creer(n + 1);
+    const uint64_t *a = bb_motsC(A);
+    const uint64_t *b = bb_motsC(B);
+    uint64_t *r = bb_mots(&R);
+
+    if (signeA == signeB) {
+        uint64_t retenue = 0;
+        for (int i = 0; i < n; ++i) {
+            uint64_t amot = (i < na) ? a[i] : 0;
+            uint64_t bmot = (i < nb) ? b[i] : 0;
+            uint64_t somme = amot + retenue;
+            retenue = (somme < retenue);
+            somme += bmot;
+            retenue += (somme < bmot);
+            r[i] = somme;
+        }
+        r[n] = retenue;
+        R.Signe = signeA;
     } else {
-        return soustractionBigBinary(A, B);  // A - B
+        R.Signe = signeA ^ (motsSoustraireAbs(r, a, na, b, nb) < 0);
+    }
+
+    normalizeBigBinary(&R);   // un résultat nul redevient positif
+    return R;
+}
+
+/**
+ * BigBinary_additionSignee - A + B pour des entiers signés
+ *
+ * EXEMPLES :
+ *   101 + (-11)  = 10      (5 - 3)
+ *   -101 + 11    = -10
+ *   -101 + (-11) = -1000
+ *
+ * @param A, B : Les BigBinary (signes quelconques)
+ * @return : A + B (normalisé, zéro positif)
+ */
+BigBinary BigBinary_additionSignee(const BigBinary A, const BigBinary B) {
+    BB_STAT_DEBUT(BB_PRIM_ADD);
+    BigBinary R = combinerSigne(&A, A.Signe, &B, B.Signe);
+    BB_STAT_FIN(BB_PRIM_ADD, A.Taille + B.Taille);
+    return R;
+}
+
+/**
+ * BigBinary_soustractionSignee - A - B pour des entiers signés
+ *
+ * RÔLE : Contrairement à soustractionBigBinary, pas de précondition :
+ *   11 - 101 = -10
+ *
+ * @param A, B : Les BigBinary (signes quelconques)
+ * @return : A - B (normalisé, zéro positif)
+ */
+BigBinary BigBinary_soustractionSignee(const BigBinary A, const BigBinary B) {
+    BB_STAT_DEBUT(BB_PRIM_SUB);
+    BigBinary R = combinerSigne(&A, A.Signe, &B, !B.Signe);
+    BB_STAT_FIN(BB_PRIM_SUB, A.Taille + B.Taille);
+    return R;
+}
+
+/**
+ * BigBinary_oppose - -A
+ *
+ * @param A : Le BigBinary
+ * @return : Une copie de A de signe contraire (0 reste positif)
+ */
+BigBinary BigBinary_oppose(const BigBinary A) {
+    BigBinary R = copieBigBinary(A);
+    if (!estZero(R)) R.Signe = !R.Signe;
+    return R;
+}
+
+/**
+ * BigBinary_compareSigne - Comparaison à trois issues d'entiers signés
+ *
+ * LOGIQUE :
+ *   1. Signes différents → le positif est le plus grand (le zéro est positif)
+ *   2. Même signe → comparaison des valeurs absolues, inversée si négatifs
+ *
+ * @param A, B : Les BigBinary (normalisés)
+ * @return : -1 si A < B, 0 si A = B, 1 si A > B
+ */
+int BigBinary_compareSigne(const BigBinary A, const BigBinary B) {
+    BB_STAT_COMPTER(BB_PRIM_CMP, A.Taille);
+
+    // CAS 1 : Signes différents
+    if (A.Signe != B.Signe) return A.Signe ? -1 : 1;
+
+    // CAS 2 : Même signe → valeurs absolues (inversées si négatifs)
+    int c = BigBinary_cmp(A, B);
+    return A.Signe ? -c : c;
+}
+
+/**
+ * BigBinary_decaleDroiteSigne - Décalage arithmétique : ⌊A / 2^n⌋
+ *
+ * RÔLE : decaleDroite tronque vers zéro (-101 >> 1 = -10) ; ici on
+ *   arrondit vers -∞ comme le ">>" d'un entier en complément à deux :
+ *   -101 >> 1 = -11 (⌊-5/2⌋ = -3). Pour A ≥ 0 les deux sont identiques.
+ *
+ * Le décalage à gauche conserve déjà le signe : decaleGauche convient
+ * aux nombres signés.
+ *
+ * @param A : Le BigBinary (signe quelconque)
+ * @param n : Nombre de positions (bits) de décalage
+ * @return : ⌊A / 2^n⌋ (normalisé)
+ */
+BigBinary BigBinary_decaleDroiteSigne(const BigBinary A, int n) {
+    BigBinary R = decaleDroite(A, n);
+    if (!A.Signe || n <= 0) return R;
+
+    // Des bits à 1 ont été perdus : |R| + 1 (arrondi vers -∞)
+    const uint64_t *a = bb_motsC(&A);
+    int perdus = 0;
+    for (int i = 0; i < A.Taille && i * BB_BITS_MOT < n && !perdus; ++i) {
+        int bits = n - i * BB_BITS_MOT;
+        uint64_t masque = bits >= BB_BITS_MOT ? ~0ULL : ((1ULL << bits) - 1);
+        perdus = (a[i] & masque) != 0;
     }
+    if (perdus) {
+        bb_reserver(&R, R.Taille + 1);
+        uint64_t *r = bb_mots(&R);
+        r[R.Taille] = 0;
+        int i = 0;
+        while (++r[i] == 0) i++;   // propagation de la retenue
+        R.Taille++;
+        R.Signe = 1;
+        R.Normalise = 0;
+        normalizeBigBinary(&R);
+    }
+    return R;
 }
 
 /**
@@ -598,6 +1007,9 @@ BigBinary soustractionAbsolue(const BigBinary A, const BigBinary B) {
  *
  * USAGE : Pour l'algorithme de Stein (PGCD binaire)
  *
+ * Les mots nuls sont sautés d'un coup, puis l'instruction ctz donne le
+ * nombre de zéros du premier mot non nul.
+ *
  * EXEMPLE :
  *   1011000 → 3 trailing zeros
  *   1010101 → 0 trailing zeros
@@ -606,26 +1018,15 @@ BigBinary soustractionAbsolue(const BigBinary A, const BigBinary B) {
  * @return : Nombre de zéros de fin
  */
 static int countTrailingZeros(const BigBinary A) {
-    int c = 0;
-    // Parcourir de droite à gauche (LSB → MSB)
-    for (int i = A.Taille - 1; i >= 0; --i) {
-        if (A.Tdigits[i] == 0) {
-            c++;  // Incrémenter le compteur
-        }
-        else {
-            break;  // Dès qu'on trouve un 1, on s'arrête
+    const uint64_t *a = bb_motsC(&A);
+    // Parcourir de droite à gauche (LSB → MSB), un mot à la fois
+    for (int i = 0; i < A.Taille; ++i) {
+        if (a[i] != 0) {
+            // Dès qu'on trouve un mot non nul, ctz donne la position de son premier 1
+            return i * BB_BITS_MOT + bb_ctz64(a[i]);
         }
     }
-    return c;
-}
-
-/**
- * rshift1 - Décalage à droite d'une position (divise par 2)
- *
- * RÔLE : Helper pour simplifier le code (équivalent à A >> 1)
- */
-static BigBinary rshift1(const BigBinary A) {
-    return decaleDroite(A, 1);
+    return 0;  // A = 0 : pas de bit à 1
 }
 
 /**
@@ -665,6 +1066,11 @@ static BigBinary lshiftK(const BigBinary A, int k) {
  * @return : PGCD(A, B) (l'appelant doit libérer)
  */
 BigBinary pgcdBinaire(const BigBinary A, const BigBinary B) {
+    BB_STAT_DEBUT(BB_PRIM_PGCD);
+
+    // Tous les temporaires de la boucle viennent de l'arène du thread
+    BBPortee portee = bb_porteeOuvrir();
+
     // ÉTAPE 1 : Créer des copies de travail (modifiables)
     BigBinary X = copieBigBinary(A);
     normalizeBigBinary(&X);
@@ -674,11 +1080,13 @@ BigBinary pgcdBinaire(const BigBinary A, const BigBinary B) {
     // ÉTAPE 2 : Cas de base
     if (estZero(X)) {
         libereBigBinary(&X);
-        return Y;  // PGCD(0, Y) = Y
+        BB_STAT_FIN(BB_PRIM_PGCD, A.Taille + B.Taille);
+        return bb_porteeFermer(portee, Y);  // PGCD(0, Y) = Y
     }
     if (estZero(Y)) {
         libereBigBinary(&Y);
-        return X;  // PGCD(X, 0) = X
+        BB_STAT_FIN(BB_PRIM_PGCD, A.Taille + B.Taille);
+        return bb_porteeFermer(portee, X);  // PGCD(X, 0) = X
     }
 
     // ÉTAPE 3 : Extraire les facteurs de 2 communs
@@ -686,53 +1094,34 @@ BigBinary pgcdBinaire(const BigBinary A, const BigBinary B) {
     int ky = countTrailingZeros(Y);  // Y = Y' × 2^ky
     int k  = (kx < ky) ? kx : ky;    // k = min(kx, ky)
 
-    // ÉTAPE 4 : Diviser X et Y par 2^kx et 2^ky (rendre impairs)
-    BigBinary t;
-    t = decaleDroite(X, kx);
-    libereBigBinary(&X);
-    X = t;
-
-    t = decaleDroite(Y, ky);
-    libereBigBinary(&Y);
-    Y = t;
+    // ÉTAPE 4 : Diviser X et Y par 2^kx et 2^ky (rendre impairs), en place
+    decaleDroiteEnPlace(&X, kx);
+    decaleDroiteEnPlace(&Y, ky);
 
     // ÉTAPE 5 : Rendre X impair (sécurité, normalement déjà fait)
-    while (estPair(X)) {
-        t = rshift1(X);
-        libereBigBinary(&X);
-        X = t;
-    }
+    if (estPair(X)) decaleDroiteEnPlace(&X, countTrailingZeros(X));
 
     // ÉTAPE 6 : Boucle principale de l'algorithme de Stein
+    // T reçoit |Y - X| ; les trois tableaux tournent, aucune allocation par tour
+    BigBinary T = bb_creer(Y.Taille > X.Taille ? Y.Taille : X.Taille);
     while (!estZero(Y)) {
-        // 6a. Rendre Y impair
-        while (estPair(Y)) {
-            t = rshift1(Y);
-            libereBigBinary(&Y);
-            Y = t;
-        }
+        // 6a. Rendre Y impair : tous ses zéros de fin partent en un seul décalage
+        if (estPair(Y)) decaleDroiteEnPlace(&Y, countTrailingZeros(Y));
 
-        // 6b. S'assurer que X <= Y (échanger si nécessaire)
-        if (Inferieur(Y, X) == 0 && Egal(Y, X) == 0) {
-            // Y >= X et Y != X → Y > X
-            if (Inferieur(X, Y) == 0) {
-                // X >= Y → swap
-                BigBinary tmp = X;
-                X = Y;
-                Y = tmp;
-            }
-        } else if (Inferieur(X, Y) == 0) {
-            // X >= Y → swap
-            BigBinary tmp = X;
+        // 6b. T = |Y - X| ; le signe dit lequel était le plus petit
+        BigBinary libre;
+        if (BigBinary_subAbs(&T, Y, X) < 0) {
+            libre = X;   // Y < X → Y devient le nouveau X
             X = Y;
-            Y = tmp;
+        } else {
+            libre = Y;
         }
 
-        // 6c. Y = Y - X (deviendra pair, sera divisé par 2 au prochain tour)
-        t = soustractionAbsolue(Y, X);
-        libereBigBinary(&Y);
-        Y = t;
+        // 6c. Y = |Y - X| (pair, sera divisé par 2 au prochain tour)
+        Y = T;
+        T = libre;
     }
+    libereBigBinary(&T);
 
     // ÉTAPE 7 : Réappliquer les facteurs de 2 extraits (multiplier par 2^k)
     BigBinary G = lshiftK(X, k);
@@ -743,7 +1132,8 @@ BigBinary pgcdBinaire(const BigBinary A, const BigBinary B) {
 
     // Nettoyage
     normalizeBigBinary(&G);
-    return G;
+    BB_STAT_FIN(BB_PRIM_PGCD, A.Taille + B.Taille);
+    return bb_porteeFermer(portee, G);
 }
 
 /**
@@ -751,24 +1141,26 @@ BigBinary pgcdBinaire(const BigBinary A, const BigBinary B) {
  *
  * RÔLE : Reste de la division de A par B
  *
- * ALGORITHME : Soustraction répétée avec alignement
- *   On soustrait B décalé à gauche (B×2^k) tant que possible
- *   pour se rapprocher rapidement de 0
+ * ALGORITHME : Division longue mot par mot (algorithme D de Knuth,
+ *   voir bigbinary_noyaux.c)
+ *   Comme la division posée à la main, mais en base 2^64 : chaque tour
+ *   estime un mot entier du quotient à partir des mots de tête, puis
+ *   soustrait q × B du reste partiel
  *
  * PRINCIPE :
  *   1. Si A < B → résultat = A
- *   2. Sinon, trouver le plus grand k tel que B×2^k <= A
- *   3. Soustraire B×2^k de A
- *   4. Répéter jusqu'à A < B
+ *   2. Sinon, normaliser B (bit de tête à 1) pour fiabiliser l'estimation
+ *   3. Pour chaque mot du quotient : estimer, corriger, soustraire
+ *   4. Le reste final, décalé en sens inverse, est A mod B
  *
  * EXEMPLE : 19 mod 5
- *   19 = 10011₂, 5 = 101₂
- *   k=2 : 5×4=10100₂ > 19 → non
- *   k=1 : 5×2=1010₂ <= 19 → 19-10=1001₂ (9)
- *   k=1 : 5×2=1010₂ > 9 → non
- *   k=0 : 5×1=101₂ <= 9 → 9-5=100₂ (4)
+ *   19 = 10011₂, 5 = 101₂ (un seul mot chacun)
+ *   Division courte : 19 = 3×5 + 4
  *   Résultat : 4
  *
+ * COMPLEXITÉ : O(nA × nB) multiplications de mots, au lieu d'une
+ *   soustraction de B×2^k par bit de A
+ *
  * @param A : Le dividende
  * @param B : Le diviseur (doit être > 0)
  * @return : A mod B (normalisé)
@@ -780,169 +1172,247 @@ BigBinary BigBinary_mod(const BigBinary A, const BigBinary B) {
         return initBigBinary();
     }
 
-    // CAS 2 : Copier A comme reste initial
-    BigBinary R = copieBigBinary(A);
-
-    // CAS 3 : Si A < B, le reste est déjà A
-    if (Inferieur(R, B)) return R;
-
-    // CAS 4 : Soustraction répétée avec alignement
-    int maxShift = R.Taille - B.Taille;  // Décalage maximum possible
-
-    for (int k = maxShift; k >= 0; --k) {
-        // Calculer B × 2^k
-        BigBinary Bk = decaleGauche(B, k);
-
-        // Si R >= B×2^k, soustraire
-        if (!Inferieur(R, Bk)) {
-            BigBinary tmp = soustractionBigBinary(R, Bk);
-            libereBigBinary(&R);
-            R = tmp;
-        }
-
-        // Libère B<<k
-        libereBigBinary(&Bk);
+    BB_STAT_DEBUT(BB_PRIM_MOD);
 
-        // Optimisation : si R = 0, on peut arrêter
-        if (estZero(R)) break;
+    // CAS 2 : Si A < B, le reste est déjà A ; si A = B, il est nul
+    int c = BigBinary_cmp(A, B);
+    if (c <= 0) {
+        BB_STAT_FIN(BB_PRIM_MOD, A.Taille);
+        return (c < 0) ? copieBigBinary(A) : initBigBinary();
     }
 
-    return R;  // Normalisé par soustractionBigBinary
+    // CAS 3 : Division longue, le reste tient sur les mots de B
+    int nA = bb_motsUtiles(&A);
+    int nB = bb_motsUtiles(&B);
+    BigBinary R = bb_creer(nB);
+    bb_divMots(NULL, bb_mots(&R), bb_motsC(&A), nA, bb_motsC(&B), nB);
+
+    normalizeBigBinary(&R);
+    BB_STAT_FIN(BB_PRIM_MOD, A.Taille);
+    return R;
 }
 
 /**
- * add_mod - Addition modulaire : (X + Y) mod mod
+ * BigBinary_mul_mod - Multiplication modulaire : (X × Y) mod mod
  *
- * RÔLE : Additionne puis prend le modulo (évite les débordements)
+ * RÔLE : Multiplie deux BigBinary modulo un troisième
  *
- * @param X, Y : Opérandes
- * @param mod : Le modulo
- * @return : (X + Y) mod mod
- */
-static BigBinary add_mod(const BigBinary X, const BigBinary Y, const BigBinary mod) {
-    // Addition binaire X + Y
-    BigBinary s = additionBigBinary(X, Y);
-
-    // On réduit modulo mod
-    BigBinary r = BigBinary_mod(s, mod);
-
-    // Libère la somme intermédiaire
-    libereBigBinary(&s);
-    return r;
-}
-
-/**
- * lshift1_mod - Décalage gauche modulaire : (X × 2) mod mod
+ * ALGORITHME : Produit complet puis une seule réduction
+ *   1. P = X × Y mot par mot (schoolbook, ou carré si X et Y sont
+ *      le même nombre : moitié moins de produits)
+ *   2. P mod mod par division longue, avec le diviseur déjà normalisé
+ *      (préparé une fois par l'appelant, voir bb_moduleObtenir)
  *
- * RÔLE : Multiplie par 2 puis prend le modulo
+ * EXEMPLE : 5 × 3 mod 7
+ *   P = 15, 15 = 2×7 + 1
+ *   Résultat : 1
  *
- * @param X : Opérande
- * @param mod : Le modulo
- * @return : (X × 2) mod mod
+ * @param X, Y : Les opérandes
+ * @param red : Le modulo préparé
+ * @return : (X × Y) mod mod
  */
-static BigBinary lshift1_mod(const BigBinary X, const BigBinary mod) {
-    // Décalage gauche → multiplie par 2
-    BigBinary d = decaleGauche(X, 1);
-
-    // Réduction modulo mod
-    BigBinary r = BigBinary_mod(d, mod);
-
-    // On libère le résultat du décalage non réduit
-    libereBigBinary(&d);
+static BigBinary BigBinary_mul_mod(const BigBinary X, const BigBinary Y, const BBModulo *red) {
+    BB_STAT_DEBUT(BB_PRIM_MULMOD);
+
+    int nx = bb_motsUtiles(&X);
+    int ny = bb_motsUtiles(&Y);
+    int nm = red->nv;
+    BigBinary R = bb_creer(nm);
+
+    // Un facteur nul : le produit est nul
+    if (nx > 0 && ny > 0) {
+        // Produit complet (+ 1 mot de marge pour la réduction)
+        uint64_t *p = (uint64_t*)bb_allouer((size_t)(nx + ny + 1) * sizeof(uint64_t));
+        const uint64_t *x = bb_motsC(&X);
+        const uint64_t *y = bb_motsC(&Y);
+        if (x == y && nx == ny) bb_carreMots(p, x, nx);
+        else bb_mulMots(p, x, nx, y, ny);
+
+        bb_moduloReduire(red, NULL, bb_mots(&R), p, nx + ny);
+        bb_liberer(p);
+    }
 
-    return r;
+    normalizeBigBinary(&R);
+    BB_STAT_FIN(BB_PRIM_MULMOD, nm);
+    return R;
 }
 
 /**
- * BigBinary_mul_mod - Multiplication modulaire : (X × Y) mod mod
- *
- * RÔLE : Multiplie deux BigBinary modulo un troisième (sans débordement)
+ * expModPetitExposant - (M^e) mod mod pour un exposant d'au plus 64 bits
  *
- * ALGORITHME : Multiplication "schoolbook" par décalages et additions
- *   C'est équivalent à la multiplication que l'on apprend à l'école,
- *   mais en binaire et avec modulo à chaque étape
+ * RÔLE : Chemin rapide des opérations à clé publique (e = 3, 65537...)
  *
- * PRINCIPE :
- *   X × Y = X × (somme des bits de Y × leur poids en puissance de 2)
+ * ALGORITHME : Carré-et-multiplie de gauche à droite
+ *   On part du bit de tête de e (acc = M) puis, pour chaque bit suivant :
+ *   acc = acc², et si le bit vaut 1 : acc = acc × M
+ *   Pour e = 65537 = 2^16 + 1 : 16 carrés + 1 multiplication, contre
+ *   17 carrés + 2 multiplications pour la version générale (LSB → MSB)
  *
- *   On traite Y bit par bit :
- *   - Si bit = 1 : ajouter X décalé de la position du bit
- *   - Puis décaler X d'une position (multiplier par 2)
+ * Tout se fait dans des tampons de mots : aucun BigBinary intermédiaire.
+ *   - module impair : produits de Montgomery ; les constantes (R² mod N)
+ *     viennent du cache, sinon leur calcul coûterait plus que la chaîne ;
+ *   - module pair : produit complet puis division longue (diviseur
+ *     normalisé, lui aussi pris dans le cache).
  *
- * EXEMPLE : 5 × 3 mod 7
- *   5 = 101₂, 3 = 11₂
- *   res = 0, a = 5
- *   bit 0 de 3 = 1 : res = (0 + 5) mod 7 = 5, a = (5×2) mod 7 = 3
- *   bit 1 de 3 = 1 : res = (5 + 3) mod 7 = 1
- *   Résultat : 1 (car 5×3 = 15 = 2×7 + 1)
- *
- * @param X, Y : Les opérandes
- * @param mod : Le modulo
- * @return : (X × Y) mod mod
+ * @param M : La base
+ * @param e : L'exposant (0 accepté)
+ * @param mod : Le modulo (non nul)
+ * @return : (M^e) mod mod
  */
-static BigBinary BigBinary_mul_mod(const BigBinary X, const BigBinary Y, const BigBinary mod) {
-    // Initialisation
-    BigBinary a = BigBinary_mod(X, mod);    // a = X mod mod
-    BigBinary b = copieBigBinary(Y);        // b = Y (sera divisé par 2 à chaque tour)
-    BigBinary res = initBigBinary();        // res = 0 (accumulateur)
-
-    // Boucle : tant que b != 0
-    while (!estZero(b)) {
-        // Si b est impair (bit de poids faible = 1)
-        if (!estPair(b)) {
-            // res = (res + a) mod mod
-            BigBinary tmp = add_mod(res, a, mod);
-
-            // remplace res = tmp
-            libereBigBinary(&res);
-            res = tmp;
-        }
+static BigBinary expModPetitExposant(const BigBinary M, uint64_t e, const BigBinary mod) {
+    BB_STAT_DEBUT(BB_PRIM_EXPMOD);
+    int n = bb_motsUtiles(&mod);
 
-        // a = (a × 2) mod mod (décalage gauche)
-        BigBinary a2 = lshift1_mod(a, mod);
-        libereBigBinary(&a);
-        a = a2;
+    // CAS 1 : mod == 1 → tout est nul ; e == 0 → M^0 = 1
+    if (n == 1 && bb_motsC(&mod)[0] == 1) {
+        BB_STAT_FIN(BB_PRIM_EXPMOD, n);
+        return initBigBinary();
+    }
+    if (e == 0) {
+        BB_STAT_FIN(BB_PRIM_EXPMOD, n);
+        return initBigBinaryFromString("1");
+    }
 
-        // b = b >> 1 (diviser par 2)
-        BigBinary b2 = decaleDroite(b, 1);
-        libereBigBinary(&b);
-        b = b2;
+    // Les tampons de travail viennent de l'arène du thread
+    BBPortee portee = bb_porteeOuvrir();
+    const BBContexteModule *ctx = bb_moduleObtenir(bb_motsC(&mod), n);
+
+    // base = M mod mod, sur n mots
+    uint64_t *base = (uint64_t*)bb_allouer((size_t)n * sizeof(uint64_t));
+    uint64_t *acc  = (uint64_t*)bb_allouer((size_t)n * sizeof(uint64_t));
+    uint64_t *prod = (uint64_t*)bb_allouer((size_t)(2 * n + 1) * sizeof(uint64_t));
+    int nM = bb_motsUtiles(&M);
+    uint64_t *tM = (uint64_t*)bb_allouer((size_t)(nM + 1) * sizeof(uint64_t));
+    memcpy(tM, bb_motsC(&M), (size_t)nM * sizeof(uint64_t));
+    bb_moduloReduire(&ctx->red, NULL, base, tM, nM);
+    bb_liberer(tM);
+
+    BigBinary R = bb_creer(n);
+    int premier = BB_BITS_MOT - 2 - bb_clz64(e);
+
+    if (ctx->mont.n != 0) {
+        // CAS 2 : module impair → Montgomery (prod sert de tampon de travail)
+        const BBMontgomery *mont = &ctx->mont;
+        bb_montMul(mont, base, base, mont->R2, prod);     // base~
+        memcpy(acc, base, (size_t)n * sizeof(uint64_t));
+        for (int i = premier; i >= 0; --i) {
+            bb_montMul(mont, acc, acc, acc, prod);
+            if ((e >> i) & 1ULL) bb_montMul(mont, acc, acc, base, prod);
+        }
+        memset(base, 0, (size_t)n * sizeof(uint64_t));
+        base[0] = 1;
+        bb_montMul(mont, bb_mots(&R), acc, base, prod);   // sortie : acc~ × 1
+    } else {
+        // CAS 3 : module pair → un carré par bit après celui de tête, une multiplication par bit à 1
+        memcpy(acc, base, (size_t)n * sizeof(uint64_t));
+        for (int i = premier; i >= 0; --i) {
+            bb_carreMots(prod, acc, n);
+            bb_moduloReduire(&ctx->red, NULL, acc, prod, 2 * n);
+
+            if ((e >> i) & 1ULL) {
+                bb_mulMots(prod, acc, n, base, n);
+                bb_moduloReduire(&ctx->red, NULL, acc, prod, 2 * n);
+            }
+        }
+        memcpy(bb_mots(&R), acc, (size_t)n * sizeof(uint64_t));
     }
+    normalizeBigBinary(&R);
 
-    // Nettoyage
-    libereBigBinary(&a);
-    libereBigBinary(&b);
+    bb_liberer(prod);
+    bb_liberer(acc);
+    bb_liberer(base);
+    bb_moduleRendre(ctx);
 
-    return res;
+    BB_STAT_FIN(BB_PRIM_EXPMOD, n);
+    return bb_porteeFermer(portee, R);
 }
 
 /**
- * to_u64 - Convertit un BigBinary en uint64_t
+ * reduireBase - dst = M mod N sur exactement n mots
+ *
+ * Division longue seulement si M a au moins autant de mots que N ; sinon
+ * simple copie complétée de zéros (cas le plus courant : M < N).
+ */
+static void reduireBase(uint64_t *dst, const BigBinary *M, const BBMontgomery *mont, int n) {
+    int nM = bb_motsUtiles(M);
+    if (nM >= n) {
+        bb_divMots(NULL, dst, bb_motsC(M), nM, mont->N, n);
+    } else {
+        memset(dst, 0, (size_t)n * sizeof(uint64_t));
+        memcpy(dst, bb_motsC(M), (size_t)nM * sizeof(uint64_t));
+    }
+}
+
+/**
+ * expModMontgomery - (M^exp) mod mod pour un module impair
+ *
+ * RÔLE : Chemin principal de BigBinary_expMod (les modules RSA sont impairs)
+ *
+ * ALGORITHME : Fenêtre fixe de gauche à droite, en représentation de
+ *   Montgomery (voir bb_montMul) : plus aucune division dans la boucle
  *
- * RÔLE : Pour les opérations nécessitant un entier natif (< 64 bits)
+ * ÉTAPES :
+ *   1. table[i] = (base^i)~ pour i < 2^k
+ *   2. acc = table[bits de tête], puis pour chaque fenêtre de k bits :
+ *      k carrés, et une multiplication par table[fenêtre] si elle est non nulle
+ *   3. sortie de la représentation : montMul(acc, 1)
  *
- * LIMITE : Ne fonctionne que si le BigBinary a au plus 64 bits
+ * Les constantes du module viennent du cache (bb_moduleObtenir).
  *
- * @param E : Le BigBinary à convertir
- * @param out : Pointeur vers la variable recevant le résultat
- * @return : 1 si succès, 0 si E > 64 bits
+ * @param M : La base
+ * @param exp : L'exposant (non nul)
+ * @param mod : Le modulo (impair, > 1)
+ * @return : (M^exp) mod mod
  */
-static int to_u64(const BigBinary E, unsigned long long *out) {
-    // Vérification : pas plus de 64 bits
-    if (E.Taille > 64) return 0;
-
-    unsigned long long v = 0ULL;
-
-    // Construire le nombre bit par bit
-    for (int i = 0; i < E.Taille; ++i) {
-        // on décale v pour faire de la place
-        v = (v << 1)
-            // puis on ajoute le bit actuel
-          | (unsigned long long)(E.Tdigits[i] ? 1 : 0);
+static BigBinary expModMontgomery(const BigBinary M, const BigBinary exp, const BigBinary mod) {
+    int n = bb_motsUtiles(&mod);
+    int nbBitsExp = BigBinary_nbBits(exp);
+    int k = bb_tailleFenetre(nbBitsExp);
+    size_t octets = (size_t)n * sizeof(uint64_t);
+
+    // Tous les tampons viennent de l'arène du thread
+    BBPortee portee = bb_porteeOuvrir();
+
+    // Constantes du module (n0, R² mod N) : cache partagé
+    const BBContexteModule *ctx = bb_moduleObtenir(bb_motsC(&mod), n);
+    const BBMontgomery *mont = &ctx->mont;
+
+    uint64_t *table = (uint64_t*)bb_allouer(((size_t)1 << k) * octets);
+    uint64_t *acc = (uint64_t*)bb_allouer(octets);
+    uint64_t *un = (uint64_t*)bb_allouerZero(octets);
+    uint64_t *t = (uint64_t*)bb_allouer((size_t)(n + 2) * sizeof(uint64_t));
+    un[0] = 1;
+
+    // ÉTAPE 1 : base = M mod mod, puis table des puissances en représentation de Montgomery
+    uint64_t *base = table + n;
+    reduireBase(base, &M, mont, n);
+    bb_montMul(mont, table, un, mont->R2, t);         // 1~ = R mod N
+    bb_montMul(mont, base, base, mont->R2, t);        // base~
+    for (int i = 2; i < (1 << k); ++i)
+        bb_montMul(mont, table + (size_t)i * n, table + (size_t)(i - 1) * n, base, t);
+
+    // ÉTAPE 2 : fenêtres de gauche à droite (la première peut être plus courte)
+    int reste = nbBitsExp % k ? nbBitsExp % k : k;
+    int pos = nbBitsExp - reste;
+    memcpy(acc, table + (size_t)bb_bitsExposant(&exp, pos, reste) * n, octets);
+    while (pos > 0) {
+        pos -= k;
+        for (int j = 0; j < k; ++j) bb_montMul(mont, acc, acc, acc, t);
+        int v = bb_bitsExposant(&exp, pos, k);
+        if (v) bb_montMul(mont, acc, acc, table + (size_t)v * n, t);
     }
 
-    *out = v;
-    return 1;  // Succès
+    // ÉTAPE 3 : retour en représentation normale
+    BigBinary R = bb_creer(n);
+    bb_montMul(mont, bb_mots(&R), acc, un, t);
+    normalizeBigBinary(&R);
+
+    bb_liberer(t);
+    bb_liberer(un);
+    bb_liberer(acc);
+    bb_liberer(table);
+    bb_moduleRendre(ctx);
+    return bb_porteeFermer(portee, R);
 }
 
 /**
@@ -978,8 +1448,16 @@ static int to_u64(const BigBinary E, unsigned long long *out) {
  * COMPLEXITÉ : O(log(exp)) multiplications au lieu de O(exp)
  *   Pour exp = 1000000, seulement ~20 opérations au lieu de 1000000 !
  *
+ * Les bits de l'exposant sont lus directement dans ses mots (du LSB
+ * vers le MSB) : il n'y a donc pas de limite de taille, ce qui permet
+ * d'utiliser un exposant privé d aussi long que le module.
+ *
+ * Module impair : la même idée, par fenêtres et en représentation de
+ * Montgomery (expModMontgomery) ; la boucle ci-dessous ne sert plus
+ * qu'aux modules pairs.
+ *
  * @param M : La base
- * @param exp : L'exposant (doit tenir sur 64 bits)
+ * @param exp : L'exposant (taille quelconque)
  * @param mod : Le modulo
  * @return : (M^exp) mod mod
  */
@@ -990,53 +1468,826 @@ BigBinary BigBinary_expMod(const BigBinary M, const BigBinary exp, const BigBina
         return initBigBinary();
     }
 
-    // CAS 2 : Si mod == 1 → résultat toujours 0
-    BigBinary one = initBigBinaryFromString("1");
-    BigBinary mod_eq_1 = BigBinary_mod(one, mod);
-    if (estZero(mod_eq_1)) {
-        libereBigBinary(&mod_eq_1);
-        libereBigBinary(&one);
+    BB_STAT_DEBUT(BB_PRIM_EXPMOD);
+
+    // CAS 2 : Si mod == 1 → résultat toujours 0 ; si exp == 0 → 1
+    if (bb_motsUtiles(&mod) == 1 && bb_motsC(&mod)[0] == 1) {
+        BB_STAT_FIN(BB_PRIM_EXPMOD, mod.Taille);
         return initBigBinary();
     }
-    libereBigBinary(&mod_eq_1);
+    if (estZero(exp)) {
+        BB_STAT_FIN(BB_PRIM_EXPMOD, mod.Taille);
+        return initBigBinaryFromString("1");
+    }
 
-    // CAS 3 : Convertir l'exposant en uint64_t
-    unsigned long long e = 0ULL;
-    if (!to_u64(exp, &e)) {
-        fprintf(stderr, "Erreur: exposant > 64 bits\n");
-        libereBigBinary(&one);
-        return initBigBinary();
+    // CAS 3 : Module impair (RSA) → Montgomery
+    if (!estPair(mod)) {
+        BigBinary R = expModMontgomery(M, exp, mod);
+        BB_STAT_FIN(BB_PRIM_EXPMOD, mod.Taille);
+        return R;
     }
 
+    // CAS 4 : Module pair → carré-et-multiplie avec réduction classique
+    // Les produits intermédiaires vivent dans l'arène du thread
+    BBPortee portee = bb_porteeOuvrir();
+    const BBContexteModule *ctx = bb_moduleObtenir(bb_motsC(&mod), bb_motsUtiles(&mod));
+
     // ÉTAPE 1 : Initialisation
     BigBinary base = BigBinary_mod(M, mod);      // base = M mod mod
     BigBinary result = initBigBinaryFromString("1");  // result = 1
 
-    // ÉTAPE 2 : Boucle square-and-multiply
-    while (e > 0ULL) {
-        // Si le bit de poids faible de e est 1
-        if (e & 1ULL) {
+    // ÉTAPE 2 : Boucle square-and-multiply (bits de exp, du LSB au MSB)
+    int nbBitsExp = BigBinary_nbBits(exp);
+    for (int i = 0; i < nbBitsExp; ++i) {
+        // Si le bit courant de exp est 1
+        if (bb_bit(&exp, i)) {
             // result = (result × base) mod mod
-            BigBinary tmp = BigBinary_mul_mod(result, base, mod);
+            BigBinary tmp = BigBinary_mul_mod(result, base, &ctx->red);
             libereBigBinary(&result);
             result = tmp;
         }
 
-        // Passer au bit suivant
-        e >>= 1ULL;
-
         // Si on n'a pas fini, calculer le carré de base
-        if (e > 0ULL) {
+        if (i < nbBitsExp - 1) {
             // base = (base × base) mod mod
-            BigBinary sq = BigBinary_mul_mod(base, base, mod);
+            BigBinary sq = BigBinary_mul_mod(base, base, &ctx->red);
             libereBigBinary(&base);
             base = sq;
         }
     }
 
-    libereBigBinary(&one);
     libereBigBinary(&base);
-    return result;
+    bb_moduleRendre(ctx);
+    BB_STAT_FIN(BB_PRIM_EXPMOD, mod.Taille);
+    return bb_porteeFermer(portee, result);
+}
+
+/**
+ * multiExpMontgomery - ∏ bases[i]^exps[i] mod mod pour un module impair
+ *
+ * ALGORITHME : Fenêtres entrelacées (Straus) : une table de puissances
+ *   par base, mais une seule chaîne de carrés pour tous les exposants.
+ *   Pour chaque fenêtre de w bits : w carrés communs, puis au plus une
+ *   multiplication par base. k expMod séparés feraient k fois les carrés.
+ *
+ * ÉTAPES :
+ *   1. tables[i][v] = (bases[i]^v)~ pour 1 ≤ v < 2^w (exposants nuls ignorés)
+ *   2. fenêtres de gauche à droite sur la longueur du plus long exposant
+ *      (la première peut être plus courte, comme dans expModMontgomery)
+ *   3. sortie de la représentation : montMul(acc, 1)
+ *
+ * @param bases, exps : Les k couples (exposants non tous nuls)
+ * @param mod : Le modulo (impair, > 1)
+ * @return : ∏ bases[i]^exps[i] mod mod
+ */
+static BigBinary multiExpMontgomery(const BigBinary bases[], const BigBinary exps[], int k,
+                                    const BigBinary mod) {
+    int n = bb_motsUtiles(&mod);
+    size_t octets = (size_t)n * sizeof(uint64_t);
+
+    int nbBitsMax = 0;
+    for (int i = 0; i < k; ++i) {
+        int b = BigBinary_nbBits(exps[i]);
+        if (b > nbBitsMax) nbBitsMax = b;
+    }
+    int w = bb_tailleFenetre(nbBitsMax);
+    size_t pasTable = ((size_t)1 << w) * n;   // mots par table
+
+    BBPortee portee = bb_porteeOuvrir();
+    const BBContexteModule *ctx = bb_moduleObtenir(bb_motsC(&mod), n);
+    const BBMontgomery *mont = &ctx->mont;
+
+    uint64_t *tables = (uint64_t*)bb_allouer((size_t)k * pasTable * sizeof(uint64_t));
+    uint64_t *acc = (uint64_t*)bb_allouer(octets);
+    uint64_t *un = (uint64_t*)bb_allouerZero(octets);
+    uint64_t *t = (uint64_t*)bb_allouer((size_t)(n + 2) * sizeof(uint64_t));
+    un[0] = 1;
+
+    // ÉTAPE 1 : tables des puissances (la case 0 n'est jamais lue)
+    for (int i = 0; i < k; ++i) {
+        if (estZero(exps[i])) continue;
+        uint64_t *table = tables + (size_t)i * pasTable;
+        uint64_t *base = table + n;
+        reduireBase(base, &bases[i], mont, n);
+        bb_montMul(mont, base, base, mont->R2, t);    // base~
+        for (int v = 2; v < (1 << w); ++v)
+            bb_montMul(mont, table + (size_t)v * n, table + (size_t)(v - 1) * n, base, t);
+    }
+
+    // ÉTAPE 2 : fenêtres entrelacées ; acc reste "vide" tant qu'aucune
+    // fenêtre n'est non nulle (pas de carrés de 1)
+    int vide = 1;
+    int larg = nbBitsMax % w ? nbBitsMax % w : w;
+    int pos = nbBitsMax - larg;
+    for (;;) {
+        for (int i = 0; i < k; ++i) {
+            int v = bb_bitsExposant(&exps[i], pos, larg);
+            if (v == 0) continue;
+            const uint64_t *p = tables + (size_t)i * pasTable + (size_t)v * n;
+            if (vide) memcpy(acc, p, octets);
+            else bb_montMul(mont, acc, acc, p, t);
+            vide = 0;
+        }
+        if (pos == 0) break;
+        pos -= w;
+        larg = w;
+        if (!vide) for (int j = 0; j < w; ++j) bb_montMul(mont, acc, acc, acc, t);
+    }
+
+    // ÉTAPE 3 : retour en représentation normale
+    BigBinary R = bb_creer(n);
+    bb_montMul(mont, bb_mots(&R), acc, un, t);
+    normalizeBigBinary(&R);
+
+    bb_liberer(t);
+    bb_liberer(un);
+    bb_liberer(acc);
+    bb_liberer(tables);
+    bb_moduleRendre(ctx);
+    return bb_porteeFermer(portee, R);
+}
+
+/**
+ * BigBinary_multiExpMod - Produit de puissances : ∏ bases[i]^exps[i] mod mod
+ *
+ * RÔLE : Vérifications du type a^x · b^y mod n (signatures par lots) en
+ *   un seul passage au lieu de k expMod et k-1 multiplications modulaires
+ *
+ * GAIN : Les carrés sont partagés : pour k = 2 exposants de même taille,
+ *   environ la moitié des carrés en moins ; davantage quand k grandit.
+ *
+ * CAS :
+ *   - mod nul → erreur, 0 ; mod = 1 → 0
+ *   - tous les exposants nuls (ou k = 0) → 1
+ *   - module impair → multiExpMontgomery
+ *   - module pair → k BigBinary_expMod puis produits réduits
+ *
+ * @param bases : Les k bases
+ * @param exps : Les k exposants (tailles quelconques, peuvent différer)
+ * @param k : Nombre de couples (≥ 0)
+ * @param mod : Le modulo
+ * @return : ∏ bases[i]^exps[i] mod mod
+ */
+BigBinary BigBinary_multiExpMod(const BigBinary bases[], const BigBinary exps[], int k,
+                                const BigBinary mod) {
+    // CAS 1 : Modulo nul
+    if (estZero(mod)) {
+        fprintf(stderr, "Erreur: mod nul dans multiExpMod\n");
+        return initBigBinary();
+    }
+
+    BB_STAT_DEBUT(BB_PRIM_EXPMOD);
+
+    // CAS 2 : mod == 1 → 0 ; aucun exposant non nul → 1
+    int nonNuls = 0;
+    for (int i = 0; i < k; ++i) nonNuls += !estZero(exps[i]);
+    if (bb_motsUtiles(&mod) == 1 && bb_motsC(&mod)[0] == 1) {
+        BB_STAT_FIN(BB_PRIM_EXPMOD, mod.Taille);
+        return initBigBinary();
+    }
+    if (nonNuls == 0) {
+        BB_STAT_FIN(BB_PRIM_EXPMOD, mod.Taille);
+        return initBigBinaryFromString("1");
+    }
+
+    // CAS 3 : Module impair → carrés partagés en Montgomery
+    if (!estPair(mod)) {
+        BigBinary R = multiExpMontgomery(bases, exps, k, mod);
+        BB_STAT_FIN(BB_PRIM_EXPMOD, mod.Taille);
+        return R;
+    }
+
+    // CAS 4 : Module pair → puissances séparées, produit réduit au fur et à mesure
+    BBPortee portee = bb_porteeOuvrir();
+    const BBContexteModule *ctx = bb_moduleObtenir(bb_motsC(&mod), bb_motsUtiles(&mod));
+    BigBinary result = initBigBinaryFromString("1");
+    for (int i = 0; i < k; ++i) {
+        if (estZero(exps[i])) continue;
+        BigBinary p = BigBinary_expMod(bases[i], exps[i], mod);
+        BigBinary tmp = BigBinary_mul_mod(result, p, &ctx->red);
+        libereBigBinary(&p);
+        libereBigBinary(&result);
+        result = tmp;
+    }
+    bb_moduleRendre(ctx);
+    BB_STAT_FIN(BB_PRIM_EXPMOD, mod.Taille);
+    return bb_porteeFermer(portee, result);
+}
+
+/* ===========================================================
+ *  RACINES ENTIÈRES
+ *  ⌊A^(1/k)⌋ par la méthode de Newton sur les entiers
+ * =========================================================== */
+
+/* Produit complet A × B (bb_mulMots : résultat distinct des opérandes) */
+BigBinary bb_produit(const BigBinary A, const BigBinary B) {
+    int na = bb_motsUtiles(&A), nb = bb_motsUtiles(&B);
+    if (na == 0 || nb == 0) return initBigBinary();
+    BigBinary R = bb_creer(na + nb);
+    bb_mulMots(bb_mots(&R), bb_motsC(&A), na, bb_motsC(&B), nb);
+    normalizeBigBinary(&R);
+    return R;
+}
+
+/* Quotient ⌊A / B⌋, B > 0 */
+BigBinary bb_quotient(const BigBinary A, const BigBinary B) {
+    int na = bb_motsUtiles(&A), nb = bb_motsUtiles(&B);
+    if (na < nb) return initBigBinary();
+    BigBinary Q = bb_creer(na - nb + 1);
+    uint64_t *r = (uint64_t*)bb_allouer((size_t)nb * sizeof(uint64_t));
+    bb_divMots(bb_mots(&Q), r, bb_motsC(&A), na, bb_motsC(&B), nb);
+    bb_liberer(r);
+    normalizeBigBinary(&Q);
+    return Q;
+}
+
+/* BigBinary valant v (un mot) */
+BigBinary bb_depuisMot(uint64_t v) {
+    BigBinary R = bb_creer(1);
+    bb_mots(&R)[0] = v;
+    normalizeBigBinary(&R);
+    return R;
+}
+
+/* X^e par carrés et multiplications (e petit) */
+static BigBinary puissance(const BigBinary X, int e) {
+    BigBinary R = bb_depuisMot(1);
+    for (int i = 63 - bb_clz64((uint64_t)e); i >= 0; --i) {
+        BigBinary c = bb_produit(R, R);
+        libereBigBinary(&R);
+        R = c;
+        if ((e >> i) & 1) {
+            BigBinary m = bb_produit(R, X);
+            libereBigBinary(&R);
+            R = m;
+        }
+    }
+    return R;
+}
+
+/*
+ * ⌊t^(1/k)⌋ sur 64 bits : bit par bit. p·c > t ⇔ p > ⌊t / c⌋ : le
+ * dépassement est détecté avant la multiplication, qui ne déborde jamais.
+ */
+static uint64_t racineMot(uint64_t t, int k) {
+    uint64_t r = 0;
+    for (int b = 63 / k; b >= 0; --b) {
+        uint64_t c = r | ((uint64_t)1 << b);
+        uint64_t p = 1;
+        int depasse = 0;
+        for (int i = 0; i < k && !depasse; ++i) {
+            depasse = (p > t / c);
+            p *= c;
+        }
+        if (!depasse) r = c;
+    }
+    return r;
+}
+
+/**
+ * BigBinary_iroot - Racine k-ième entière : ⌊A^(1/k)⌋
+ *
+ * RÔLE : Tests de puissance parfaite (primalité), factorisation de Fermat
+ *   (audit de clés RSA dont p et q sont trop proches)
+ *
+ * ALGORITHME : Newton sur les entiers
+ *   x ← ⌊((k-1)·x + ⌊A / x^(k-1)⌋) / k⌋
+ *   Partant d'un x ≥ ⌊A^(1/k)⌋, la suite décroît strictement jusqu'à la
+ *   racine : on s'arrête au premier pas qui ne descend plus.
+ *
+ * ESTIMATION INITIALE : A = T·2^(k·s) + reste, T sur au plus 64 bits ;
+ *   x0 = (⌊T^(1/k)⌋ + 1)·2^s majore la racine, avec ~64/k bits justes.
+ *   Newton double ensuite les bits justes à chaque pas : quelques
+ *   divisions pleine taille au lieu d'une recherche bit par bit.
+ *
+ * EXEMPLE : ⌊1000^(1/3)⌋
+ *   T = 1000, s = 0 → x0 = 10 + 1 = 11
+ *   x1 = (2·11 + 1000/121) / 3 = (22 + 8) / 3 = 10
+ *   x2 = (2·10 + 1000/100) / 3 = 10 → ne descend plus : racine 10
+ *
+ * @param A : Le BigBinary (signe ignoré)
+ * @param k : L'indice de la racine (≥ 1)
+ * @return : ⌊A^(1/k)⌋
+ */
+BigBinary BigBinary_iroot(const BigBinary A, int k) {
+    if (k < 1) {
+        fprintf(stderr, "Erreur: indice de racine %d dans BigBinary_iroot\n", k);
+        return initBigBinary();
+    }
+
+    // CAS 1 : 0, 1 et racine première
+    int nbBits = BigBinary_nbBits(A);
+    if (nbBits <= 1 || k == 1) {
+        BigBinary R = copieBigBinary(A);
+        R.Signe = 0;
+        normalizeBigBinary(&R);
+        return R;
+    }
+
+    // CAS 2 : Indice au moins égal à la taille → la racine vaut 1
+    if (k >= nbBits) return bb_depuisMot(1);
+
+    BBPortee portee = bb_porteeOuvrir();
+
+    // ÉTAPE 1 : Estimation par excès à partir des 64 bits de tête
+    int s = (nbBits > 64) ? (nbBits - 64 + k - 1) / k : 0;
+    BigBinary T = decaleDroite(A, k * s);
+    BigBinary x = bb_depuisMot(racineMot(bb_motsC(&T)[0], k) + 1);
+    libereBigBinary(&T);
+    decaleGaucheEnPlace(&x, s);
+
+    // ÉTAPE 2 : Newton tant que la suite décroît
+    BigBinary km1 = bb_depuisMot((uint64_t)(k - 1));
+    BigBinary kk = bb_depuisMot((uint64_t)k);
+    for (;;) {
+        BigBinary p = puissance(x, k - 1);
+        BigBinary q = bb_quotient(A, p);
+        BigBinary m = bb_produit(x, km1);
+        BigBinary somme = additionBigBinary(m, q);
+        BigBinary y = (k == 2) ? decaleDroite(somme, 1) : bb_quotient(somme, kk);
+        libereBigBinary(&p); libereBigBinary(&q);
+        libereBigBinary(&m); libereBigBinary(&somme);
+
+        if (BigBinary_cmp(y, x) >= 0) {
+            libereBigBinary(&y);
+            break;
+        }
+        libereBigBinary(&x);
+        x = y;
+    }
+
+    libereBigBinary(&km1);
+    libereBigBinary(&kk);
+    return bb_porteeFermer(portee, x);
+}
+
+/**
+ * BigBinary_isqrt - Racine carrée entière : ⌊√A⌋
+ *
+ * @param A : Le BigBinary (signe ignoré)
+ * @return : ⌊√A⌋
+ */
+BigBinary BigBinary_isqrt(const BigBinary A) {
+    return BigBinary_iroot(A, 2);
+}
+
+/* ===========================================================
+ *  SYMBOLE DE JACOBI ET RACINES CARRÉES MODULAIRES
+ * =========================================================== */
+
+/**
+ * BigBinary_jacobi - Symbole de Jacobi (a / n), n impair positif
+ *
+ * RÔLE : Test de Solovay–Strassen, test de Lucas fort (Baillie–PSW),
+ *   recherche d'un non-résidu quadratique (Tonelli–Shanks)
+ *
+ * ALGORITHME : Version binaire, même boucle que pgcdBinaire (Stein) :
+ *   seuls des décalages, des comparaisons et des soustractions, le signe
+ *   étant suivi à chaque étape par les lois de réciprocité :
+ *   1. Y pair : (2 / X) = -1 si X ≡ 3, 5 mod 8 → un changement de signe
+ *      par décalage impair (tous les zéros de fin partent en une fois)
+ *   2. Y < X : échange, (Y / X) = -(X / Y) si X ≡ Y ≡ 3 mod 4
+ *   3. (Y / X) = ((Y - X) / X) : une seule soustraction par tour
+ *   Quand Y = 0, X = pgcd(a, n) : le symbole vaut 0 si X ≠ 1.
+ *   Les restes mod 4 et mod 8 ne regardent que le mot de poids faible.
+ *
+ * EXEMPLE : (5 / 21)
+ *   Y = 5 < X = 21 : échange (5 ≡ 1 mod 4) → (21 / 5) = (16 / 5)
+ *   16 = 2⁴ : décalage pair → (1 / 5) = 1
+ *
+ * @param a : Le numérateur (signe pris en compte)
+ * @param n : Le dénominateur (impair, positif)
+ * @return : -1, 0 ou 1 (0 aussi si n est pair ou nul, avec un message)
+ */
+int BigBinary_jacobi(const BigBinary a, const BigBinary n) {
+    // CAS 1 : Dénominateur invalide
+    if (estZero(n) || estPair(n)) {
+        fprintf(stderr, "Erreur: denominateur pair ou nul dans BigBinary_jacobi\n");
+        return 0;
+    }
+
+    BBPortee portee = bb_porteeOuvrir();
+
+    // CAS 2 : a < 0 → (-1 / n) = -1 si n ≡ 3 mod 4
+    int t = (a.Signe && !estZero(a) && (bb_motsC(&n)[0] & 3) == 3) ? -1 : 1;
+
+    // ÉTAPE 1 : X = n, Y = |a| mod n
+    BigBinary X = copieBigBinary(n);
+    X.Signe = 0;
+    normalizeBigBinary(&X);
+    BigBinary Y = BigBinary_mod(a, X);
+    Y.Signe = 0;
+
+    // ÉTAPE 2 : Boucle de Stein, les trois tableaux tournent
+    BigBinary T = bb_creer(X.Taille);
+    while (!estZero(Y)) {
+        // 2a. Facteurs 2 de Y
+        int z = countTrailingZeros(Y);
+        uint64_t x = bb_motsC(&X)[0];
+        if (z > 0) {
+            decaleDroiteEnPlace(&Y, z);
+            if ((z & 1) && ((x & 7) == 3 || (x & 7) == 5)) t = -t;
+        }
+
+        // 2b. T = |Y - X| ; échange (réciprocité) si Y < X
+        uint64_t y = bb_motsC(&Y)[0];
+        BigBinary libre;
+        if (BigBinary_subAbs(&T, Y, X) < 0) {
+            if ((x & 3) == 3 && (y & 3) == 3) t = -t;
+            libre = X;
+            X = Y;
+        } else {
+            libre = Y;
+        }
+        Y = T;
+        T = libre;
+    }
+
+    // ÉTAPE 3 : X = pgcd(a, n)
+    int r = (bb_motsUtiles(&X) == 1 && bb_motsC(&X)[0] == 1) ? t : 0;
+    libereBigBinary(&X);
+    libereBigBinary(&Y);
+    libereBigBinary(&T);
+    bb_porteeFermer(portee, initBigBinary());
+    return r;
+}
+
+/* 1 si A vaut v (un mot) */
+static int vautMot(const BigBinary A, uint64_t v) {
+    int n = bb_motsUtiles(&A);
+    return (v == 0) ? n == 0 : (n == 1 && bb_motsC(&A)[0] == v);
+}
+
+/**
+ * tonelliShanks - Racine de a modulo p premier, p ≡ 1 mod 4, a résidu
+ *
+ * ALGORITHME : p - 1 = q·2^s, q impair ; z non-résidu (premier entier
+ *   de symbole -1)
+ *   c = z^q, r = a^((q+1)/2), t = a^q, m = s
+ *   Invariant : r² ≡ a·t, t d'ordre divisant 2^(m-1)
+ *   Tant que t ≠ 1 : i = plus petit entier tel que t^(2^i) = 1,
+ *     b = c^(2^(m-i-1)), r = r·b, c = b², t = t·c, m = i
+ *   Trois exponentiations, puis au plus s² / 2 carrés (s petit en
+ *   pratique : s = 2 pour p ≡ 5 mod 8).
+ *
+ * @return : La racine, ou un BigBinary nul si p n'est visiblement pas premier
+ */
+static BigBinary tonelliShanks(const BigBinary a, const BigBinary p, const BBModulo *red) {
+    // ÉTAPE 1 : p - 1 = q·2^s
+    BigBinary un = bb_depuisMot(1);
+    BigBinary q = soustractionBigBinary(p, un);
+    int s = countTrailingZeros(q);
+    decaleDroiteEnPlace(&q, s);
+
+    // ÉTAPE 2 : Non-résidu z (en moyenne deux essais ; borné si p composé)
+    BigBinary z = initBigBinary();
+    for (uint64_t essai = 2; essai < 1024; ++essai) {
+        BigBinary c = bb_depuisMot(essai);
+        if (BigBinary_jacobi(c, p) == -1) {
+            z = c;
+            break;
+        }
+        libereBigBinary(&c);
+    }
+    if (estZero(z)) {
+        libereBigBinary(&un);
+        libereBigBinary(&q);
+        return initBigBinary();
+    }
+
+    // ÉTAPE 3 : c, t, r par exponentiation
+    BigBinary c = BigBinary_expMod(z, q, p);
+    BigBinary t = BigBinary_expMod(a, q, p);
+    BigBinary q1 = additionBigBinary(q, un);
+    decaleDroiteEnPlace(&q1, 1);
+    BigBinary r = BigBinary_expMod(a, q1, p);
+    libereBigBinary(&q1);
+    libereBigBinary(&z);
+    libereBigBinary(&q);
+    libereBigBinary(&un);
+
+    // ÉTAPE 4 : Réduction de l'ordre de t
+    int m = s;
+    while (!vautMot(t, 1)) {
+        // 4a. i : plus petit entier tel que t^(2^i) = 1
+        int i = 0;
+        BigBinary u = copieBigBinary(t);
+        while (!vautMot(u, 1) && i < m) {
+            BigBinary sq = BigBinary_mul_mod(u, u, red);
+            libereBigBinary(&u);
+            u = sq;
+            i++;
+        }
+        libereBigBinary(&u);
+        if (i >= m) {   // ordre trop grand : p n'est pas premier
+            libereBigBinary(&r);
+            r = initBigBinary();
+            break;
+        }
+
+        // 4b. b = c^(2^(m-i-1))
+        BigBinary b = copieBigBinary(c);
+        for (int k = 0; k < m - i - 1; ++k) {
+            BigBinary sq = BigBinary_mul_mod(b, b, red);
+            libereBigBinary(&b);
+            b = sq;
+        }
+
+        // 4c. r = r·b, c = b², t = t·c
+        BigBinary nr = BigBinary_mul_mod(r, b, red);
+        libereBigBinary(&r);
+        r = nr;
+        libereBigBinary(&c);
+        c = BigBinary_mul_mod(b, b, red);
+        libereBigBinary(&b);
+        BigBinary nt = BigBinary_mul_mod(t, c, red);
+        libereBigBinary(&t);
+        t = nt;
+        m = i;
+    }
+
+    libereBigBinary(&c);
+    libereBigBinary(&t);
+    return r;
+}
+
+/**
+ * BigBinary_sqrtMod - Racine carrée modulo un premier : r² ≡ a mod p
+ *
+ * RÔLE : Test de Lucas fort (choix des paramètres de Baillie–PSW),
+ *   décompression de points, protocoles à résidus quadratiques
+ *
+ * ALGORITHME :
+ *   CAS p ≡ 3 mod 4 : r = a^((p+1)/4), une seule exponentiation
+ *     (r² = a^((p+1)/2) = a·a^((p-1)/2) = a, le symbole valant 1)
+ *   SINON : Tonelli–Shanks (voir tonelliShanks)
+ *   Dans les deux cas le symbole de Jacobi écarte d'abord les
+ *   non-résidus, et r² ≡ a est vérifié à la fin : un p composé donne
+ *   un échec, jamais une fausse racine.
+ *
+ * EXEMPLE : a = 2, p = 7 (≡ 3 mod 4)
+ *   (2 / 7) = 1, r = 2^2 mod 7 = 4, et 4² = 16 ≡ 2 mod 7
+ *
+ * @param a : Le BigBinary dont on cherche la racine (signe ignoré)
+ * @param p : Le module (premier impair, ou 2)
+ * @param racine : Reçoit la plus petite des deux racines si trouvée
+ *   (l'appelant libère), sinon n'est pas modifié
+ * @return : 1 si a est un carré modulo p, 0 sinon
+ */
+int BigBinary_sqrtMod(const BigBinary a, const BigBinary p, BigBinary *racine) {
+    // CAS 1 : Module invalide ; p = 2 : a mod 2 est sa propre racine
+    if (estZero(p) || vautMot(p, 1) || (estPair(p) && !vautMot(p, 2))) {
+        fprintf(stderr, "Erreur: module invalide dans BigBinary_sqrtMod\n");
+        return 0;
+    }
+    BBPortee portee = bb_porteeOuvrir();
+    BigBinary A = BigBinary_mod(a, p);
+    A.Signe = 0;
+
+    BigBinary r;
+    if (vautMot(p, 2) || estZero(A)) {
+        // CAS 2 : 0 et 1 sont leurs propres racines
+        r = copieBigBinary(A);
+    } else if (BigBinary_jacobi(A, p) != 1) {
+        // CAS 3 : Non-résidu (ou p composé)
+        r = initBigBinary();
+    } else {
+        const BBContexteModule *ctx = bb_moduleObtenir(bb_motsC(&p), bb_motsUtiles(&p));
+        if ((bb_motsC(&p)[0] & 3) == 3) {
+            // CAS 4 : p ≡ 3 mod 4 → a^((p+1)/4)
+            BigBinary un = bb_depuisMot(1);
+            BigBinary e = additionBigBinary(p, un);
+            decaleDroiteEnPlace(&e, 2);
+            r = BigBinary_expMod(A, e, p);
+            libereBigBinary(&e);
+            libereBigBinary(&un);
+        } else {
+            // CAS 5 : Tonelli–Shanks
+            r = tonelliShanks(A, p, &ctx->red);
+        }
+
+        // Vérification r² ≡ a (un p composé peut tromper les deux formules)
+        BigBinary carre = BigBinary_mul_mod(r, r, &ctx->red);
+        if (BigBinary_cmp(carre, A) != 0) {
+            libereBigBinary(&r);
+            r = initBigBinary();
+        }
+        libereBigBinary(&carre);
+        bb_moduleRendre(ctx);
+    }
+
+    // La plus petite des deux racines r et p - r
+    int trouve = estZero(A) || !estZero(r);
+    if (!estZero(r)) {
+        BigBinary oppose = soustractionBigBinary(p, r);
+        if (BigBinary_cmp(oppose, r) < 0) {
+            libereBigBinary(&r);
+            r = oppose;
+        } else {
+            libereBigBinary(&oppose);
+        }
+    }
+    libereBigBinary(&A);
+
+    r = bb_porteeFermer(portee, r);
+    if (trouve) *racine = r;
+    else libereBigBinary(&r);
+    return trouve;
+}
+
+/* ===========================================================
+ *  INVERSES MODULAIRES
+ * =========================================================== */
+
+/* Division euclidienne : Q = ⌊A / B⌋, *R = A mod B (B > 0, signes ignorés) */
+static BigBinary divisionReste(const BigBinary A, const BigBinary B, BigBinary *R) {
+    int na = bb_motsUtiles(&A), nb = bb_motsUtiles(&B);
+    if (na < nb) {
+        *R = copieBigBinary(A);
+        R->Signe = 0;
+        normalizeBigBinary(R);
+        return initBigBinary();
+    }
+    BigBinary Q = bb_creer(na - nb + 1);
+    *R = bb_creer(nb);
+    bb_divMots(bb_mots(&Q), bb_mots(R), bb_motsC(&A), na, bb_motsC(&B), nb);
+    normalizeBigBinary(&Q);
+    normalizeBigBinary(R);
+    return Q;
+}
+
+/**
+ * BigBinary_modInverse - Inverse modulaire : x tel que a·x ≡ 1 mod mod
+ *
+ * RÔLE : Exposant privé d = e^(-1) mod φ(N), coefficients CRT
+ *   (q^(-1) mod p), retour aux coordonnées affines
+ *
+ * ALGORITHME : Euclide étendu, seul le coefficient de a est suivi.
+ *   r(k+1) = r(k-1) - q·r(k)  et  t(k+1) = t(k-1) - q·t(k)
+ *   Les t(k) alternent de signe : on garde leurs valeurs absolues,
+ *   u(k+1) = u(k-1) + q·u(k) (aucune soustraction signée), et la
+ *   parité du nombre de pas donne le signe final.
+ *   Le module peut être pair (φ(N) l'est toujours).
+ *
+ * EXEMPLE : 3^(-1) mod 7
+ *   7 = 2·3 + 1 → u = 2 ;  3 = 3·1 + 0 → u = 7
+ *   pgcd 1, coefficient -2 (trois pas) → 7 - 2 = 5, et 3·5 = 15 ≡ 1
+ *
+ * @param a : Le BigBinary à inverser (signe ignoré)
+ * @param mod : Le module (> 0)
+ * @param inverse : Reçoit l'inverse dans [0, mod) si trouvé (l'appelant
+ *   libère), sinon n'est pas modifié
+ * @return : 1 si pgcd(a, mod) = 1, 0 sinon
+ */
+int BigBinary_modInverse(const BigBinary a, const BigBinary mod, BigBinary *inverse) {
+    // CAS 1 : Module nul ; module 1 : tout vaut 0, inverse compris
+    if (estZero(mod)) {
+        fprintf(stderr, "Erreur: mod nul dans BigBinary_modInverse\n");
+        return 0;
+    }
+    if (vautMot(mod, 1)) {
+        *inverse = initBigBinary();
+        return 1;
+    }
+
+    BBPortee portee = bb_porteeOuvrir();
+
+    // ÉTAPE 1 : r0 = mod, r1 = a mod mod, u0 = 0, u1 = 1
+    BigBinary r0 = copieBigBinary(mod);
+    r0.Signe = 0;
+    normalizeBigBinary(&r0);
+    BigBinary r1 = BigBinary_mod(a, r0);
+    r1.Signe = 0;
+    BigBinary u0 = initBigBinary();
+    BigBinary u1 = bb_depuisMot(1);
+    int pas = 1;
+
+    // ÉTAPE 2 : Euclide, un quotient par pas
+    while (!estZero(r1)) {
+        BigBinary r;
+        BigBinary q = divisionReste(r0, r1, &r);
+        BigBinary qu = bb_produit(q, u1);
+        BigBinary u = additionBigBinary(u0, qu);
+        libereBigBinary(&q);
+        libereBigBinary(&qu);
+        libereBigBinary(&r0);
+        libereBigBinary(&u0);
+        r0 = r1; r1 = r;
+        u0 = u1; u1 = u;
+        pas++;
+    }
+
+    // ÉTAPE 3 : r0 = pgcd ; coefficient négatif après un nombre impair de pas
+    int trouve = vautMot(r0, 1);
+    BigBinary x = initBigBinary();
+    if (trouve) {
+        if (pas & 1) x = soustractionBigBinary(mod, u0);
+        else x = copieBigBinary(u0);
+        x.Signe = 0;
+    }
+    libereBigBinary(&r0); libereBigBinary(&r1);
+    libereBigBinary(&u0); libereBigBinary(&u1);
+
+    x = bb_porteeFermer(portee, x);
+    if (trouve) *inverse = x;
+    else libereBigBinary(&x);
+    return trouve;
+}
+
+/**
+ * BigBinary_modInverse_batch - Inverses de n nombres modulo le même module
+ *
+ * RÔLE : Coefficients CRT de nombreuses clés, conversions projectif →
+ *   affine : une inversion coûte un Euclide étendu complet, une
+ *   multiplication modulaire beaucoup moins
+ *
+ * ALGORITHME : Astuce de Montgomery (produits préfixes)
+ *   c(0) = x(0), c(i) = c(i-1)·x(i)
+ *   v = c(n-1)^(-1)                      (une seule inversion)
+ *   Pour i = n-1 … 1 : out(i) = v·c(i-1), v = v·x(i)
+ *   out(0) = v
+ *   Soit 3(n-1) multiplications modulaires et une inversion.
+ *
+ *   Les x ≡ 0 sont écartés du produit (out = 0). Si le produit n'est pas
+ *   inversible (un x partage un facteur avec le module), chaque x est
+ *   inversé séparément pour que les autres obtiennent leur inverse.
+ *
+ * @param xs : Les nombres à inverser (signe ignoré)
+ * @param n : Leur nombre
+ * @param mod : Le module commun (> 0)
+ * @param out : Reçoit les n inverses (0 si non inversible ; l'appelant libère)
+ * @return : Le nombre d'inverses trouvés
+ */
+int BigBinary_modInverse_batch(const BigBinary xs[], int n, const BigBinary mod, BigBinary out[]) {
+    if (estZero(mod)) {
+        fprintf(stderr, "Erreur: mod nul dans BigBinary_modInverse_batch\n");
+        for (int i = 0; i < n; ++i) out[i] = initBigBinary();
+        return 0;
+    }
+    if (n <= 0) return 0;
+
+    if (vautMot(mod, 1)) {   // tout vaut 0, inverse compris
+        for (int i = 0; i < n; ++i) out[i] = initBigBinary();
+        return n;
+    }
+
+    BBPortee portee = bb_porteeOuvrir();
+    const BBContexteModule *ctx = bb_moduleObtenir(bb_motsC(&mod), bb_motsUtiles(&mod));
+    BigBinary *x = (BigBinary*)bb_allouer((size_t)n * sizeof(BigBinary));
+    BigBinary *c = (BigBinary*)bb_allouer((size_t)n * sizeof(BigBinary));
+    BigBinary *res = (BigBinary*)bb_allouer((size_t)n * sizeof(BigBinary));
+    int *idx = (int*)bb_allouer((size_t)n * sizeof(int));
+
+    // ÉTAPE 1 : Réduction ; idx liste les m nombres non nuls
+    int m = 0;
+    for (int i = 0; i < n; ++i) {
+        x[i] = BigBinary_mod(xs[i], mod);
+        x[i].Signe = 0;
+        res[i] = initBigBinary();
+        if (!estZero(x[i])) idx[m++] = i;
+    }
+
+    // ÉTAPE 2 : Produits préfixes
+    for (int k = 0; k < m; ++k)
+        c[k] = (k == 0) ? copieBigBinary(x[idx[0]]) : BigBinary_mul_mod(c[k - 1], x[idx[k]], &ctx->red);
+
+    // ÉTAPE 3 : Une inversion, puis on redescend la chaîne
+    int trouves = 0;
+    BigBinary v;
+    if (m > 0 && BigBinary_modInverse(c[m - 1], mod, &v)) {
+        for (int k = m - 1; k > 0; --k) {
+            res[idx[k]] = BigBinary_mul_mod(v, c[k - 1], &ctx->red);
+            BigBinary w = BigBinary_mul_mod(v, x[idx[k]], &ctx->red);
+            libereBigBinary(&v);
+            v = w;
+        }
+        res[idx[0]] = v;
+        trouves = m;
+    } else {
+        // CAS : Produit non inversible → inverses séparés
+        for (int k = 0; k < m; ++k)
+            trouves += BigBinary_modInverse(x[idx[k]], mod, &res[idx[k]]);
+    }
+
+    // ÉTAPE 4 : Sorties hors de l'arène de la portée (vidée à la fermeture)
+    if (portee.ouverte) {
+        BigBinaryArena *prec = BigBinaryArena_activer(NULL);
+        for (int i = 0; i < n; ++i) out[i] = copieBigBinary(res[i]);
+        BigBinaryArena_activer(prec);
+        for (int i = 0; i < n; ++i) libereBigBinary(&res[i]);
+    } else {
+        for (int i = 0; i < n; ++i) out[i] = res[i];
+    }
+
+    for (int i = 0; i < n; ++i) libereBigBinary(&x[i]);
+    for (int k = 0; k < m; ++k) libereBigBinary(&c[k]);
+    bb_liberer(idx);
+    bb_liberer(res);
+    bb_liberer(c);
+    bb_liberer(x);
+    bb_moduleRendre(ctx);
+    bb_porteeFermer(portee, initBigBinary());
+    return trouves;
 }
 
 /* ===========================================================
@@ -1046,9 +2297,14 @@ BigBinary BigBinary_expMod(const BigBinary M, const BigBinary exp, const BigBina
 /*
  * Chiffrement RSA
  * C = M^e mod N
- * On réutilise directement l'exponentiation modulaire rapide
+ * Exposant de 64 bits au plus (cas de e = 65537) : chaîne de gauche à
+ * droite sans allocation par étape ; sinon exponentiation générale
  */
 BigBinary BigBinary_RSA_encrypt(BigBinary message, BigBinary e, BigBinary n) {
+    // Exposant public usuel (3, 65537...) : chaîne courte dédiée
+    if (BigBinary_nbBits(e) <= BB_BITS_MOT && !estZero(n)) {
+        return expModPetitExposant(message, bb_motsC(&e)[0], n);
+    }
     return BigBinary_expMod(message, e, n);
 }
 
@@ -1061,4 +2317,77 @@ BigBinary BigBinary_RSA_decrypt(BigBinary cipher, BigBinary d, BigBinary n) {
     return BigBinary_expMod(cipher, d, n);
 }
 
+/* ===========================================================
+ *  Conversions octets
+ *  Utilisées pour faire passer des fichiers binaires dans RSA
+ * =========================================================== */
+
+/**
+ * BigBinary_nbBits - Nombre de bits significatifs
+ *
+ * RÔLE : Donne la taille "utile" du nombre (le zéro a 0 bit)
+ *
+ * @param A : Le BigBinary (normalisé)
+ * @return : Nombre de bits, 0 pour zéro
+ */
+int BigBinary_nbBits(const BigBinary A) {
+    // Cas normal : longueur tenue à jour par la normalisation
+    if (A.Normalise) return A.NbBits;
+
+    // Nombre construit à la main : on normalise une copie locale
+    BigBinary N = A;
+    normalizeBigBinary(&N);
+    return N.NbBits;
+}
+
+/**
+ * initBigBinaryFromBytes - Crée un BigBinary depuis des octets
+ *
+ * RÔLE : Chaque octet donne 8 bits, le premier octet est le poids fort
+ *        (8 octets consécutifs forment un mot)
+ *
+ * @param octets : Tableau d'octets (gros-boutiste)
+ * @param n : Nombre d'octets
+ * @return : BigBinary correspondant (normalisé)
+ */
+BigBinary initBigBinaryFromBytes(const unsigned char *octets, size_t n) {
+    if (octets == NULL || n == 0) return initBigBinary();
+
+    BigBinary A = bb_creer((int)((n + 7) / 8));
+    uint64_t *m = bb_mots(&A);
 
+    // L'octet i (en partant de la fin) va dans le mot i/8, à la position 8*(i%8)
+    for (size_t i = 0; i < n; ++i) {
+        m[i / 8] |= (uint64_t)octets[n - 1 - i] << (8 * (i % 8));
+    }
+
+    // Supprimer les zéros de tête (octets nuls au début)
+    normalizeBigBinary(&A);
+    return A;
+}
+
+/**
+ * BigBinary_toBytes - Écrit un BigBinary sur n octets
+ *
+ * RÔLE : Inverse de initBigBinaryFromBytes, avec remplissage à gauche
+ *        par des zéros pour obtenir une taille fixe (blocs RSA)
+ *
+ * @param A : Le BigBinary (positif)
+ * @param out : Tampon de n octets
+ * @param n : Taille voulue en octets
+ * @return : 1 si succès, 0 si A ne tient pas sur n octets
+ */
+int BigBinary_toBytes(const BigBinary A, unsigned char *out, size_t n) {
+    int bits = BigBinary_nbBits(A);
+    if ((size_t)bits > n * 8) return 0;
+
+    memset(out, 0, n);
+
+    // Parcours du poids faible vers le poids fort : l'octet i va en out[n-1-i]
+    const uint64_t *m = bb_motsC(&A);
+    size_t nbOctets = ((size_t)bits + 7) / 8;
+    for (size_t i = 0; i < nbOctets; ++i) {
+        out[n - 1 - i] = (unsigned char)(m[i / 8] >> (8 * (i % 8)));
+    }
+    return 1;
+}
@@ -4,29 +4,55 @@
 #include <stdio.h>   // Pour printf, scanf, etc.
 #include <stdlib.h>  // Pour malloc, free, etc.
 #include <string.h>  // Pour strlen, strcpy, etc.
+#include <stdint.h>  // Pour uint64_t
 
 /* ===========================================================
  *  STRUCTURE PRINCIPALE
  * =========================================================== */
 
+/**
+ * Nombre de mots de 64 bits stockés directement dans la structure.
+ * Les valeurs jusqu'à 256 bits (exposants publics, compteurs, petits
+ * restes, constantes de boucle...) ne font donc aucune allocation.
+ */
+#define BIGBINARY_MOTS_INTERNES 4
+
 /**
  * Structure BigBinary : représente un grand nombre en binaire
  *
  * Cette structure permet de manipuler des nombres binaires de taille arbitraire,
  * bien plus grands que les types natifs (int, long, etc.)
+ *
+ * Les bits sont regroupés par mots de 64 bits. Tant que le nombre tient
+ * dans Interne[], aucun tableau n'est alloué ; au-delà, Tdigits pointe
+ * vers un tableau sur le tas (ou dans une arène). On accède toujours aux
+ * mots par la structure elle-même, jamais par un pointeur gardé de côté :
+ * une copie par valeur emporte son propre stockage interne.
  */
 typedef struct {
-    int *Tdigits;  // 📌 Tableau dynamique de bits (0 ou 1)
-                   //    Exemple : 1011 sera stocké comme [1, 0, 1, 1]
-                   //    MSB-first = Most Significant Bit en premier (poids fort à gauche)
+    uint64_t *Tdigits; // 📌 Tableau de mots de 64 bits sur le tas
+                       //    Poids faible en premier : Tdigits[0] contient les bits 0..63
+                       //    NULL quand le nombre tient dans Interne[] (pas d'allocation)
+
+    int Taille;        // 📌 Nombre de mots utilisés (au moins 1)
+                       //    Exemple : 1011 tient dans 1 mot, Taille = 1
+                       //    Zéro = un seul mot nul
+
+    int Signe;         // 📌 Signe du nombre :
+                       //    - 0 = positif
+                       //    - 1 = négatif
+                       //    (En Phase 1, on travaille uniquement avec des nombres non signés)
+
+    int Capacite;      // 📌 Nombre de mots disponibles (dans Tdigits ou Interne)
 
-    int Taille;    // 📌 Nombre de bits dans le tableau
-                   //    Exemple : pour 1011, Taille = 4
+    int NbBits;        // 📌 Nombre de bits significatifs (0 pour zéro)
+                       //    Valide seulement si Normalise = 1
 
-    int Signe;     // 📌 Signe du nombre :
-                   //    - 0 = positif
-                   //    - 1 = négatif
-                   //    (En Phase 1, on travaille uniquement avec des nombres non signés)
+    int Normalise;     // 📌 1 si le nombre est déjà normalisé (pas de mot nul de tête)
+                       //    → normalisation, estZero et BigBinary_nbBits en O(1)
+
+    uint64_t Interne[BIGBINARY_MOTS_INTERNES];
+                       // 📌 Stockage des petits nombres (≤ 256 bits) dans la structure
 } BigBinary;
 
 /* ===========================================================
@@ -102,6 +128,17 @@ int Egal(const BigBinary A, const BigBinary B);
  */
 int Inferieur(const BigBinary A, const BigBinary B);
 
+/**
+ * BigBinary_cmp() : Comparaison à trois issues (non signée)
+ *
+ * Paramètres : A et B = les deux nombres à comparer (signes ignorés)
+ * Retour : -1 si A < B, 0 si A == B, 1 si A > B
+ *
+ * Un seul parcours depuis le mot de poids fort : à préférer à une suite
+ * Inferieur(A, B) / Egal(A, B) / Inferieur(B, A) sur la même paire.
+ */
+int BigBinary_cmp(const BigBinary A, const BigBinary B);
+
 // 🔹 OPÉRATIONS ARITHMÉTIQUES DE BASE
 
 /**
@@ -141,6 +178,7 @@ BigBinary soustractionBigBinary(const BigBinary A, const BigBinary B);
  * Retour : 1 si A == 0, 0 sinon
  *
  * Utilité : Optimisation des algorithmes (éviter divisions par zéro, etc.)
+ * Coût : O(1) sur un nombre normalisé (cas de tous les résultats)
  */
 int estZero(const BigBinary A);
 
@@ -195,6 +233,82 @@ BigBinary decaleGauche(const BigBinary A, int n);
  */
 BigBinary decaleDroite(const BigBinary A, int n);
 
+/**
+ * decaleGaucheEnPlace() / decaleDroiteEnPlace() : Décalages sans allocation
+ *
+ * Paramètres :
+ *   - A = pointeur vers le nombre à décaler (modifié)
+ *   - n = nombre de positions à décaler
+ *
+ * Même résultat que A = decaleGauche(A, n) / decaleDroite(A, n), mais dans
+ * le stockage de A : pas de nouveau tableau (sauf si A doit grandir au-delà
+ * de sa capacité). À utiliser dans les boucles qui décalent à chaque tour.
+ */
+void decaleGaucheEnPlace(BigBinary *A, int n);
+void decaleDroiteEnPlace(BigBinary *A, int n);
+
+// === OPÉRATIONS BIT À BIT (bigbinary_bits.c) ===
+//
+// Sur les valeurs absolues (signes ignorés), résultats positifs. Boucles
+// sur les mots de 64 bits : AVX2 et popcnt si le CPU les a.
+
+/**
+ * BigBinary_and() / BigBinary_or() / BigBinary_xor() : |A| ET / OU / OU exclusif |B|
+ *
+ * Retour : Un nouveau BigBinary
+ * Exemple : and(1100, 1010) = 1000, or = 1110, xor = 110
+ */
+BigBinary BigBinary_and(const BigBinary A, const BigBinary B);
+BigBinary BigBinary_or(const BigBinary A, const BigBinary B);
+BigBinary BigBinary_xor(const BigBinary A, const BigBinary B);
+
+/**
+ * BigBinary_not() : Complément de |A| sur "bits" bits, (2^bits − 1) − |A|
+ *
+ * Les bits de A au-delà de "bits" sont ignorés.
+ * Exemple : BigBinary_not(1010, 6) = 110101
+ */
+BigBinary BigBinary_not(const BigBinary A, int bits);
+
+/**
+ * Versions en place : A = A op B dans le stockage de A (pas de nouveau
+ * tableau, sauf si A doit grandir). B peut être A.
+ */
+void BigBinary_andEnPlace(BigBinary *A, const BigBinary B);
+void BigBinary_orEnPlace(BigBinary *A, const BigBinary B);
+void BigBinary_xorEnPlace(BigBinary *A, const BigBinary B);
+void BigBinary_notEnPlace(BigBinary *A, int bits);
+
+// Nombre de bits à 1 de A
+int BigBinary_popcount(const BigBinary A);
+
+// Bit numéro i de A (0 = poids faible ; 0 au-delà de la taille)
+int BigBinary_testBit(const BigBinary A, int i);
+
+// Met le bit i de A à v (0 ou 1) ; A grandit si besoin
+void BigBinary_setBit(BigBinary *A, int i, int v);
+
+/**
+ * BigBinary_bitPoidsFort() / BigBinary_bitPoidsFaible() : Position du bit à 1
+ * le plus haut / le plus bas, -1 si A = 0
+ *
+ * Exemple : pour 101100, 5 et 2
+ */
+int BigBinary_bitPoidsFort(const BigBinary A);
+int BigBinary_bitPoidsFaible(const BigBinary A);
+
+/**
+ * BigBinary_extraireBits() : Les k bits de A à partir du bit "bas" (k ≤ 64)
+ *
+ * Lit au plus deux mots (fenêtres d'exponentiation, index de crible).
+ * Exemple : BigBinary_extraireBits(1101100, 2, 3) = 011
+ */
+uint64_t BigBinary_extraireBits(const BigBinary A, int bas, int k);
+
+// Noyaux actifs ("avx2" ou "portable") ; choisirNoyauxBits : 1 si disponible
+const char *BigBinary_noyauxBits(void);
+int BigBinary_choisirNoyauxBits(const char *nom);
+
 // === OPÉRATIONS ÉTENDUES ===
 
 /**
@@ -209,6 +323,57 @@ BigBinary decaleDroite(const BigBinary A, int n);
  */
 BigBinary soustractionAbsolue(const BigBinary A, const BigBinary B);
 
+/**
+ * BigBinary_subAbs() : |A - B| et signe de A - B en une seule passe
+ *
+ * Paramètres :
+ *   - R = résultat (BigBinary valide : son tableau est réutilisé s'il est
+ *     assez grand, R peut être A ou B)
+ *   - A, B = les opérandes (signes ignorés)
+ * Retour : -1 si A < B, 0 si A == B, 1 si A > B
+ *
+ * Exemple :
+ *   BigBinary_subAbs(&R, 1011, 1101) → R = 0010, retourne -1
+ */
+int BigBinary_subAbs(BigBinary *R, const BigBinary A, const BigBinary B);
+
+// === ARITHMÉTIQUE SIGNÉE ===
+//
+// Signe = 1 pour un nombre négatif (valeur absolue dans les mots), le zéro
+// est toujours positif. additionBigBinary / soustractionBigBinary restent
+// non signées ; les fonctions ci-dessous acceptent toutes les combinaisons
+// de signes.
+
+/**
+ * BigBinary_additionSignee() / BigBinary_soustractionSignee() : A + B, A - B
+ *
+ * Pas de précondition sur l'ordre de A et B ; une seule passe sur les
+ * valeurs absolues quand les signes diffèrent.
+ * Exemple :
+ *   BigBinary_soustractionSignee(11, 101) = -10 (3 - 5 = -2)
+ */
+BigBinary BigBinary_additionSignee(const BigBinary A, const BigBinary B);
+BigBinary BigBinary_soustractionSignee(const BigBinary A, const BigBinary B);
+
+/** BigBinary_oppose() : -A (nouveau BigBinary) */
+BigBinary BigBinary_oppose(const BigBinary A);
+
+/**
+ * BigBinary_compareSigne() : Comparaison d'entiers signés
+ *
+ * Retour : -1 si A < B, 0 si A = B, 1 si A > B
+ */
+int BigBinary_compareSigne(const BigBinary A, const BigBinary B);
+
+/**
+ * BigBinary_decaleDroiteSigne() : ⌊A / 2^n⌋ (décalage arithmétique)
+ *
+ * decaleDroite tronque vers zéro ; celle-ci arrondit vers -∞, comme le
+ * ">>" d'un entier en complément à deux. decaleGauche conserve le signe.
+ * Exemple : BigBinary_decaleDroiteSigne(-101, 1) = -11 (⌊-5/2⌋ = -3)
+ */
+BigBinary BigBinary_decaleDroiteSigne(const BigBinary A, int n);
+
 // === ALGORITHME DE PGCD BINAIRE ===
 
 /**
@@ -251,18 +416,87 @@ BigBinary BigBinary_mod(const BigBinary A, const BigBinary B);
  *
  * Paramètres :
  *   - M = la base
- *   - exp = l'exposant (doit tenir sur 64 bits maximum)
+ *   - exp = l'exposant (taille quelconque, par ex. un exposant privé RSA)
  *   - mod = le modulo
  *
  * Retour : (M^exp) mod mod
  *
  * Exemple :
  *   BigBinary_expMod(5, 3, 13) = (5³) mod 13 = 125 mod 13 = 8
- *
- * ⚠️ LIMITATION : exp doit être ≤ 64 bits (suffisant pour la plupart des applications)
  */
 BigBinary BigBinary_expMod(const BigBinary M, const BigBinary exp, const BigBinary mod);
 
+/**
+ * BigBinary_multiExpMod() : Produit de puissances modulaire
+ *
+ * Paramètres :
+ *   - bases, exps = tableaux de k bases et k exposants
+ *   - k = nombre de couples
+ *   - mod = le modulo
+ *
+ * Retour : (bases[0]^exps[0] × ... × bases[k-1]^exps[k-1]) mod mod
+ *
+ * Une seule chaîne de carrés pour tous les exposants (fenêtres
+ * entrelacées) : a^x · b^y mod n coûte à peu près un expMod et demi au
+ * lieu de deux expMod et une multiplication.
+ *
+ * Exemple :
+ *   bases = {2, 3}, exps = {3, 2}, mod = 7 → (8 × 9) mod 7 = 2
+ */
+BigBinary BigBinary_multiExpMod(const BigBinary bases[], const BigBinary exps[], int k,
+                                const BigBinary mod);
+
+// === RACINES ENTIÈRES ===
+
+/**
+ * BigBinary_isqrt() : Racine carrée entière ⌊√A⌋
+ * BigBinary_iroot() : Racine k-ième entière ⌊A^(1/k)⌋ (k ≥ 1)
+ *
+ * Méthode de Newton à partir d'une estimation tirée des 64 bits de tête :
+ * quelques divisions pleine taille. A est une puissance k-ième exacte si
+ * et seulement si la racine, élevée à la puissance k, redonne A.
+ *
+ * Exemple :
+ *   BigBinary_isqrt(11000) = 100 (√24 → 4)
+ *   BigBinary_iroot(1111101000, 3) = 1010 (∛1000 = 10)
+ */
+BigBinary BigBinary_isqrt(const BigBinary A);
+BigBinary BigBinary_iroot(const BigBinary A, int k);
+
+// === SYMBOLE DE JACOBI ET RACINES CARRÉES MODULAIRES ===
+
+/**
+ * BigBinary_jacobi() : Symbole de Jacobi (a / n) ∈ {-1, 0, 1}, n impair
+ * BigBinary_sqrtMod() : r tel que r² ≡ a mod p, p premier
+ *
+ * Le symbole est calculé par la boucle binaire de pgcdBinaire
+ * (décalages et soustractions, pas de division). La racine utilise
+ * a^((p+1)/4) si p ≡ 3 mod 4, Tonelli–Shanks sinon ; elle est vérifiée
+ * avant d'être rendue (retour 0 : non-résidu, ou p non premier).
+ *
+ * Exemple :
+ *   BigBinary_jacobi(101, 10101) = 1 ((5 / 21))
+ *   BigBinary_sqrtMod(10, 111, &r) = 1, r = 11 (3² = 9 ≡ 2 mod 7)
+ */
+int BigBinary_jacobi(const BigBinary a, const BigBinary n);
+int BigBinary_sqrtMod(const BigBinary a, const BigBinary p, BigBinary *racine);
+
+// === INVERSES MODULAIRES ===
+
+/**
+ * BigBinary_modInverse() : x tel que a·x ≡ 1 mod mod (Euclide étendu),
+ *   module quelconque ; retour 0 si pgcd(a, mod) ≠ 1
+ * BigBinary_modInverse_batch() : les n inverses de xs[] modulo le même
+ *   module, astuce de Montgomery : une inversion et 3(n-1)
+ *   multiplications ; out[i] = 0 si xs[i] n'est pas inversible.
+ *   Retour : le nombre d'inverses trouvés.
+ *
+ * Exemple :
+ *   BigBinary_modInverse(11, 111, &x) = 1, x = 101 (3·5 = 15 ≡ 1 mod 7)
+ */
+int BigBinary_modInverse(const BigBinary a, const BigBinary mod, BigBinary *inverse);
+int BigBinary_modInverse_batch(const BigBinary xs[], int n, const BigBinary mod, BigBinary out[]);
+
 // ================= PHASE 3 : RSA simplifié =================
 
 // Chiffrement RSA : C = M^e mod N
@@ -271,6 +505,356 @@ BigBinary BigBinary_RSA_encrypt(BigBinary message, BigBinary e, BigBinary n);
 // Déchiffrement RSA : M = C^d mod N
 BigBinary BigBinary_RSA_decrypt(BigBinary cipher, BigBinary d, BigBinary n);
 
+// === EXPONENTIATION PAR LOTS (bigbinary_lot.c) ===
+
+/**
+ * BigBinary_expModLot() : Même exposant et même module pour k messages
+ *
+ * resultats[i] = messages[i]^exp mod mod. Les messages sont calculés
+ * ensemble, un par voie SIMD (8 avec AVX-512 IFMA, 4 avec AVX2), en
+ * représentation de Montgomery ; moteur choisi selon le CPU au premier
+ * appel, BigBinary_expMod message par message sinon.
+ *
+ * Les k résultats sont à libérer par l'appelant.
+ */
+void BigBinary_expModLot(const BigBinary *messages, BigBinary *resultats, int k,
+                         const BigBinary exp, const BigBinary mod);
+
+// Nom du moteur utilisé par BigBinary_expModLot ("avx512ifma", "avx2", "scalaire")
+const char *BigBinary_moteurLot(void);
+
+// Impose un moteur (s'il est disponible sur ce CPU) : 1 si accepté.
+// À appeler avant de lancer des calculs concurrents.
+int BigBinary_choisirMoteurLot(const char *nom);
+
+// === NOYAUX ARITHMÉTIQUES (bigbinary_noyaux.c) ===
+
+// Nom des noyaux de multiplication utilisés ("bmi2-adx" ou "portable"),
+// choisis au premier calcul selon le CPU (instruction cpuid).
+const char *BigBinary_noyaux(void);
+
+// Impose des noyaux (s'ils sont disponibles sur ce CPU) : 1 si accepté.
+// À appeler avant de lancer des calculs concurrents.
+int BigBinary_choisirNoyaux(const char *nom);
+
+// === CACHE DES MODULES (bigbinary_cache.c) ===
+//
+// BigBinary_expMod, BigBinary_RSA_encrypt et BigBinary_RSA_decrypt gardent
+// les constantes de chaque module (Montgomery, R² mod N, diviseur normalisé)
+// dans un cache partagé par tous les threads, borné, éviction LRU.
+
+// Nombre maximal de modules gardés (16 par défaut, 0 = pas de cache)
+void BigBinary_cacheCapacite(int nb);
+
+// Oublie tous les modules et remet les compteurs à zéro
+void BigBinary_cacheVider(void);
+
+// Nombre de modules trouvés / préparés depuis le dernier vidage (NULL accepté)
+void BigBinary_cacheStats(unsigned long long *succes, unsigned long long *echecs);
+
+// === CONVERSIONS OCTETS (chiffrement de fichiers) ===
+
+/**
+ * BigBinary_nbBits() : Nombre de bits significatifs de A
+ *
+ * Retour : 0 si A == 0, sinon la position du bit de poids fort + 1
+ * Exemple : BigBinary_nbBits(1011) = 4
+ *
+ * Coût : O(1), la longueur est tenue à jour par la normalisation
+ */
+int BigBinary_nbBits(const BigBinary A);
+
+/**
+ * initBigBinaryFromBytes() : Crée un BigBinary depuis des octets (gros-boutiste)
+ *
+ * Paramètres : octets = tableau d'octets, le premier est le poids fort
+ *              n = nombre d'octets
+ *
+ * Exemple : {0x01, 0x02} → 100000010 (258 en décimal)
+ */
+BigBinary initBigBinaryFromBytes(const unsigned char *octets, size_t n);
+
+/**
+ * BigBinary_toBytes() : Écrit A sur exactement n octets (gros-boutiste)
+ *
+ * Les octets de poids fort inutilisés sont mis à 0.
+ *
+ * Retour : 1 si A tient sur n octets, 0 sinon (out est alors indéfini)
+ */
+int BigBinary_toBytes(const BigBinary A, unsigned char *out, size_t n);
+
+
+/* ===========================================================
+ *  EXPONENTIATION À BASE FIXE (bigbinary_basefixe.c)
+ * =========================================================== */
+
+/**
+ * BigBinaryFixedBase : g^e mod n pour une base et un module fixés
+ *
+ * Les puissances de g sont précalculées une fois (peigne de Lim–Lee) :
+ * chaque évaluation fait alors peu de carrés (⌈L / (dents × blocs)⌉ pour
+ * un exposant de L bits, au lieu de L).
+ *
+ * Utilisation :
+ *   BigBinaryFixedBase *G = BigBinaryFixedBase_creer(g, p, 0, 0, 0);
+ *   BigBinary A = BigBinaryFixedBase_expMod(G, a);     // g^a mod p
+ *   BigBinary B = BigBinaryFixedBase_expMod(G, b);
+ *   BigBinaryFixedBase_detruire(G);
+ *
+ * 📌 La table compte blocs × 2^dents nombres de la taille du module :
+ *    plus de dents ou de blocs → moins de carrés, plus de mémoire et un
+ *    précalcul plus long.
+ * 📌 Module pair, ou exposant plus long que bitsExposant : repli sur
+ *    BigBinary_expMod (résultat identique).
+ * 📌 Objet en lecture seule après création : utilisable par plusieurs
+ *    threads à la fois.
+ */
+typedef struct BigBinaryFixedBase BigBinaryFixedBase;
+
+/*
+ * Crée la table pour g et mod
+ *   bitsExposant : taille maximale des exposants (0 → taille du module)
+ *   dents : lignes du peigne, 1 à 16 (0 → 8)
+ *   blocs : blocs par ligne (0 → 2)
+ * Retourne NULL si mod est nul.
+ */
+BigBinaryFixedBase *BigBinaryFixedBase_creer(const BigBinary g, const BigBinary mod,
+                                             int bitsExposant, int dents, int blocs);
+
+// g^exp mod mod (même résultat que BigBinary_expMod(g, exp, mod))
+BigBinary BigBinaryFixedBase_expMod(const BigBinaryFixedBase *B, const BigBinary exp);
+
+// Mémoire occupée par la table, en octets (0 si pas de table)
+size_t BigBinaryFixedBase_taille(const BigBinaryFixedBase *B);
+
+// Libère la table et rend le contexte du module
+void BigBinaryFixedBase_detruire(BigBinaryFixedBase *B);
+
+/* ===========================================================
+ *  AUDIT DES MODULES RSA FAIBLES (bigbinary_facteurs.c)
+ * =========================================================== */
+
+/**
+ * BigBinaryBudget : limite de travail d'une méthode de factorisation
+ *
+ * 📌 iterations : sens propre à chaque méthode, et coût très différent :
+ *    - Fermat : tours (défaut 100000)
+ *    - rho    : pas de la variante de Brent (défaut 2^18)
+ *    - p − 1  : borne B1 du crible (défaut 100000), plafonnée à 10^7 car
+ *               le crible occupe B1 octets ; au-delà, seul le temps compte
+ *    0 → défaut de la méthode. BigBinary_auditerModules passe le même
+ *    budget aux trois.
+ * 📌 secondes : temps maximal par méthode (0 → pas de limite)
+ */
+typedef struct {
+    long long iterations;
+    double secondes;
+} BigBinaryBudget;
+
+typedef enum {
+    BB_FACT_AUCUNE,     // aucun facteur dans le budget
+    BB_FACT_TRIVIALE,   // module pair
+    BB_FACT_FERMAT,     // p et q proches
+    BB_FACT_PM1,        // p − 1 friable
+    BB_FACT_RHO         // petit facteur
+} BigBinaryMethodeFact;
+
+typedef struct {
+    BigBinaryMethodeFact methode;   // 📌 Méthode qui a trouvé le facteur
+    BigBinary facteur;              // 📌 Facteur non trivial (0 si aucun), à libérer
+    double secondes;                // 📌 Durée de l'audit de ce module
+} BigBinaryAudit;
+
+/*
+ * Une méthode sur un module impair N : 1 et *facteur (1 < facteur < N, à
+ * libérer) si elle trouve, 0 sinon. budget = NULL → valeurs par défaut.
+ *   - fermat      : N = a² - b², rapide si |p - q| est petit devant N^(1/4)
+ *   - pollardPm1  : p − 1 dont tous les facteurs premiers sont ≤ B1
+ *   - pollardRho  : facteur de ~2 × log2(itérations) bits au plus (Brent)
+ */
+int BigBinary_fermat(const BigBinary N, const BigBinaryBudget *budget, BigBinary *facteur);
+int BigBinary_pollardPm1(const BigBinary N, const BigBinaryBudget *budget, BigBinary *facteur);
+int BigBinary_pollardRho(const BigBinary N, const BigBinaryBudget *budget, BigBinary *facteur);
+
+/*
+ * Audite nb modules sur nbThreads threads (0 → un par cœur) : pour chacun,
+ * Fermat, puis p − 1, puis rho, chacune avec le même budget ; arrêt au
+ * premier facteur. resultats[i] correspond à modules[i].
+ */
+void BigBinary_auditerModules(const BigBinary *modules, BigBinaryAudit *resultats, int nb,
+                              const BigBinaryBudget *budget, int nbThreads);
+
+/* ===========================================================
+ *  NOMBRES ALÉATOIRES (bigbinary_alea.c)
+ * =========================================================== */
+
+/**
+ * BigBinaryAlea : générateur pseudo-aléatoire qui remplit directement les mots
+ *
+ * Deux algorithmes :
+ *   - BB_ALEA_XOSHIRO  : xoshiro256**, très rapide, reproductible à partir
+ *                        d'une graine (tests, fuzzing, banc de mesure)
+ *   - BB_ALEA_CHACHA20 : flux ChaCha20 (RFC 8439), imprévisible sans la clé
+ *                        (génération de clés, nombres premiers)
+ *
+ * Utilisation :
+ *   BigBinaryAlea g;
+ *   BigBinaryAlea_init(&g, BB_ALEA_XOSHIRO, 42);   // ou BigBinaryAlea_initSysteme
+ *   BigBinary A = BigBinary_random(1024, &g);       // 0 ≤ A < 2^1024
+ *   BigBinary B = BigBinary_randomBelow(N, &g);     // 0 ≤ B < N
+ *
+ * 📌 g = NULL → générateur du thread courant (ChaCha20, graine getrandom
+ *    au premier appel) : aucun verrou, aucune initialisation à faire.
+ * 📌 Un BigBinaryAlea ne doit être utilisé que par un seul thread à la fois.
+ * ⚠️ Après fork(), le processus fils reprend le même flux : le réinitialiser
+ *    (BigBinaryAlea_initSysteme(BigBinaryAlea_duThread(), BB_ALEA_CHACHA20))
+ */
+typedef enum {
+    BB_ALEA_XOSHIRO,
+    BB_ALEA_CHACHA20
+} BigBinaryAleaType;
+
+typedef struct {
+    BigBinaryAleaType type;
+    uint64_t s[4];          // xoshiro256** : état
+    uint32_t cle[8];        // ChaCha20 : clé de 256 bits
+    uint64_t bloc;          // ChaCha20 : numéro du prochain bloc
+    uint64_t tampon[8];     // ChaCha20 : sortie du dernier bloc (64 octets)
+    int reste;              // ChaCha20 : mots de tampon pas encore rendus
+} BigBinaryAlea;
+
+// Graine fixe : même graine → même suite (clé ChaCha20 dérivée de la graine)
+void BigBinaryAlea_init(BigBinaryAlea *g, BigBinaryAleaType type, uint64_t graine);
+
+// Clé ChaCha20 explicite (32 octets), flux à partir du bloc 0
+void BigBinaryAlea_initCle(BigBinaryAlea *g, const unsigned char cle[32]);
+
+/*
+ * Graine tirée du système (getrandom, sinon /dev/urandom)
+ * Retourne 1, ou 0 si aucune source n'a répondu : la graine vient alors de
+ * l'horloge et de l'adresse de g (suffisant pour des tests, pas pour des clés).
+ */
+int BigBinaryAlea_initSysteme(BigBinaryAlea *g, BigBinaryAleaType type);
+
+// Générateur du thread courant (celui qu'utilise g = NULL)
+BigBinaryAlea *BigBinaryAlea_duThread(void);
+
+// 64 bits pseudo-aléatoires (g = NULL → générateur du thread)
+uint64_t BigBinaryAlea_mot(BigBinaryAlea *g);
+
+/*
+ * Nombre uniforme dans [0, 2^bits[ (zéro si bits ≤ 0)
+ * Pour "exactement bits bits", mettre ensuite le bit de tête à 1.
+ */
+BigBinary BigBinary_random(int bits, BigBinaryAlea *g);
+
+/*
+ * Nombre uniforme dans [0, n[ par rejet sur nbBits(n) bits (moins de deux
+ * tirages en moyenne). n doit être > 0 (sinon message d'erreur et zéro).
+ */
+BigBinary BigBinary_randomBelow(const BigBinary n, BigBinaryAlea *g);
+
+/* ===========================================================
+ *  ARÈNES D'ALLOCATION (bigbinary_arena.c)
+ * =========================================================== */
+
+/**
+ * BigBinaryArena : pool de mémoire pour les tableaux Tdigits
+ *
+ * Les blocs viennent de classes de tailles recyclées et d'une allocation
+ * par incrément, puis sont tous libérés d'un coup par BigBinaryArena_vider().
+ * Une arène ne doit être utilisée que par un seul thread à la fois.
+ *
+ * Utilisation :
+ *   BigBinaryArena *a = BigBinaryArena_creer(0);
+ *   BigBinaryArena *prec = BigBinaryArena_activer(a);
+ *   ... calculs : tous les BigBinary créés ici vivent dans a ...
+ *   BigBinaryArena_activer(prec);
+ *   BigBinaryArena_vider(a);      // libère tout (libereBigBinary facultatif)
+ *
+ * Sans arène active, les opérations lourdes (BigBinary_mod, pgcdBinaire,
+ * BigBinary_expMod) placent quand même leurs temporaires dans l'arène par
+ * défaut du thread et rendent un résultat alloué sur le tas.
+ *
+ * ⚠️ Un BigBinary issu d'une arène devient invalide après BigBinaryArena_vider()
+ */
+typedef struct BigBinaryArena BigBinaryArena;
+
+// Crée une arène (tailleMorceau = 0 → 64 Kio par morceau)
+BigBinaryArena *BigBinaryArena_creer(size_t tailleMorceau);
+
+// Libère en bloc tout ce qui a été alloué dans l'arène
+void BigBinaryArena_vider(BigBinaryArena *arena);
+
+// Détruit l'arène et rend sa mémoire
+void BigBinaryArena_detruire(BigBinaryArena *arena);
+
+// Active une arène sur le thread courant (NULL = tas), retourne la précédente
+BigBinaryArena *BigBinaryArena_activer(BigBinaryArena *arena);
+
+// Arène par défaut du thread courant (détruite à la fin du thread)
+BigBinaryArena *BigBinaryArena_duThread(void);
+
+/* ===========================================================
+ *  COMPTEURS D'OPÉRATIONS (bigbinary_stats.c)
+ * =========================================================== */
+
+/**
+ * Instrumentation optionnelle des primitives
+ *
+ * Activée à la compilation par BIGBINARY_INSTRUMENTATION (option CMake
+ * -DBIGBINARY_INSTRUMENTATION=ON). Sans elle, aucun compteur n'est mis à
+ * jour (coût nul) et les fonctions ci-dessous rendent des zéros.
+ *
+ * 📌 Les cycles sont inclusifs : ceux d'un BigBinary_mod comprennent les
+ *    soustractions et décalages qu'il appelle. cmp et normalise ne sont
+ *    que comptés (pas chronométrés : la mesure coûterait plus que l'appel).
+ * 📌 Les compteurs sont propres à chaque thread (pas de verrou sur le
+ *    chemin chaud) ; BigBinaryStats_total() les additionne.
+ */
+typedef enum {
+    BB_PRIM_ADD,
+    BB_PRIM_SUB,        // soustractionBigBinary / soustractionAbsolue / BigBinary_subAbs
+    BB_PRIM_CMP,        // Egal / Inferieur / BigBinary_cmp
+    BB_PRIM_MOD,
+    BB_PRIM_MULMOD,
+    BB_PRIM_DECALAGE,   // décalages gauche / droite (copie ou en place)
+    BB_PRIM_NORMALISE,
+    BB_PRIM_PGCD,
+    BB_PRIM_EXPMOD,
+    BB_NB_PRIMITIVES
+} BigBinaryPrimitive;
+
+typedef struct {
+    unsigned long long appels;   // nombre d'appels
+    unsigned long long mots;     // mots de 64 bits traités (taille des opérandes)
+    unsigned long long cycles;   // cycles cumulés (rdtsc, ou ns hors x86)
+} BigBinaryCompteur;
+
+typedef struct {
+    BigBinaryCompteur prim[BB_NB_PRIMITIVES];
+    unsigned long long allocations;     // tableaux de mots alloués
+    unsigned long long allocationsTas;  // ... dont hors arène (malloc)
+    unsigned long long octetsAlloues;
+} BigBinaryStats;
+
+// 1 si la bibliothèque est compilée avec l'instrumentation
+int BigBinaryStats_active(void);
+
+// Compteurs du thread courant
+void BigBinaryStats_thread(BigBinaryStats *out);
+
+// Somme des compteurs de tous les threads (vivants et terminés)
+void BigBinaryStats_total(BigBinaryStats *out);
+
+// Remet tous les compteurs à zéro
+void BigBinaryStats_reinitialiser(void);
+
+// Nom court d'une primitive ("add", "mod", ...)
+const char *BigBinaryStats_nom(BigBinaryPrimitive p);
+
+// Affiche un tableau des compteurs non nuls
+void BigBinaryStats_afficher(FILE *f, const BigBinaryStats *s);
 
 #endif // BIGBINARY_H
 
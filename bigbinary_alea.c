@@ -0,0 +1,292 @@
+#include "bigbinary_interne.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(__linux__)
+#include <sys/random.h>
+#endif
+
+/*
+ * ============================================================================
+ * NOMBRES ALÉATOIRES : xoshiro256** ET ChaCha20
+ * ============================================================================
+ *
+ * Les nombres sont produits mot par mot directement dans Tdigits : pas de
+ * chaîne binaire ni de tableau d'octets intermédiaire.
+ *
+ *   - xoshiro256** (Blackman–Vigna) : 4 mots d'état, quelques décalages et
+ *     une multiplication par mot produit. Graine étendue par splitmix64.
+ *   - ChaCha20 (RFC 8439) : un bloc de 64 octets (8 mots) par appel de la
+ *     fonction de bloc, compteur de blocs sur 64 bits et nonce nul (variante
+ *     d'origine de Bernstein ; identique à la RFC tant que le nonce est nul).
+ *
+ * Chaque thread a son propre générateur par défaut (_Thread_local) : les
+ * appels avec g = NULL ne prennent aucun verrou.
+ * ============================================================================
+ */
+
+/* ===========================================================
+ *  xoshiro256** et splitmix64
+ * =========================================================== */
+
+static inline uint64_t rotl64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/* splitmix64 : étend une graine de 64 bits (jamais un état tout à zéro) */
+static uint64_t splitmix64(uint64_t *x) {
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static inline uint64_t xoshiroSuivant(uint64_t s[4]) {
+    uint64_t r = rotl64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+    return r;
+}
+
+/* ===========================================================
+ *  ChaCha20
+ * =========================================================== */
+
+static inline uint32_t rotl32(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+#define QUART(a, b, c, d)                       \
+    do {                                        \
+        a += b; d ^= a; d = rotl32(d, 16);      \
+        c += d; b ^= c; b = rotl32(b, 12);      \
+        a += b; d ^= a; d = rotl32(d, 8);       \
+        c += d; b ^= c; b = rotl32(b, 7);       \
+    } while (0)
+
+/**
+ * chachaBloc - Calcule le bloc g->bloc du flux et le range dans g->tampon
+ *
+ * ALGORITHME : état de 16 mots de 32 bits (constantes, clé, compteur,
+ *   nonce), 10 doubles tours (colonnes puis diagonales), puis ajout de
+ *   l'état initial. Les 16 mots de sortie, lus en petit-boutiste, donnent
+ *   les 8 mots de 64 bits du tampon.
+ */
+static void chachaBloc(BigBinaryAlea *g) {
+    uint32_t e[16] = {
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,   // "expand 32-byte k"
+        g->cle[0], g->cle[1], g->cle[2], g->cle[3],
+        g->cle[4], g->cle[5], g->cle[6], g->cle[7],
+        (uint32_t)g->bloc, (uint32_t)(g->bloc >> 32), 0, 0
+    };
+    uint32_t x[16];
+    memcpy(x, e, sizeof(x));
+
+    for (int i = 0; i < 10; ++i) {
+        QUART(x[0], x[4], x[8],  x[12]);
+        QUART(x[1], x[5], x[9],  x[13]);
+        QUART(x[2], x[6], x[10], x[14]);
+        QUART(x[3], x[7], x[11], x[15]);
+        QUART(x[0], x[5], x[10], x[15]);
+        QUART(x[1], x[6], x[11], x[12]);
+        QUART(x[2], x[7], x[8],  x[13]);
+        QUART(x[3], x[4], x[9],  x[14]);
+    }
+
+    for (int i = 0; i < 8; ++i)
+        g->tampon[i] = (uint64_t)(x[2 * i] + e[2 * i])
+                     | ((uint64_t)(x[2 * i + 1] + e[2 * i + 1]) << 32);
+    g->bloc++;
+    g->reste = 8;
+}
+
+/* ===========================================================
+ *  Initialisation
+ * =========================================================== */
+
+void BigBinaryAlea_initCle(BigBinaryAlea *g, const unsigned char cle[32]) {
+    if (g == NULL) return;
+    memset(g, 0, sizeof(*g));
+    g->type = BB_ALEA_CHACHA20;
+    for (int i = 0; i < 8; ++i)
+        g->cle[i] = (uint32_t)cle[4 * i] | ((uint32_t)cle[4 * i + 1] << 8)
+                  | ((uint32_t)cle[4 * i + 2] << 16) | ((uint32_t)cle[4 * i + 3] << 24);
+}
+
+/* Remplit l'état à partir de 32 octets de graine */
+static void initOctets(BigBinaryAlea *g, BigBinaryAleaType type, const unsigned char o[32]) {
+    if (type == BB_ALEA_CHACHA20) {
+        BigBinaryAlea_initCle(g, o);
+        return;
+    }
+    memset(g, 0, sizeof(*g));
+    g->type = BB_ALEA_XOSHIRO;
+    memcpy(g->s, o, sizeof(g->s));
+    if ((g->s[0] | g->s[1] | g->s[2] | g->s[3]) == 0) g->s[0] = 1;   // état nul interdit
+}
+
+void BigBinaryAlea_init(BigBinaryAlea *g, BigBinaryAleaType type, uint64_t graine) {
+    if (g == NULL) return;
+    unsigned char o[32];
+    for (int i = 0; i < 4; ++i) {
+        uint64_t v = splitmix64(&graine);
+        for (int k = 0; k < 8; ++k) o[8 * i + k] = (unsigned char)(v >> (8 * k));
+    }
+    initOctets(g, type, o);
+}
+
+/* Lit n octets de la source du système : 1 si tout a été lu */
+static int octetsSysteme(unsigned char *o, size_t n) {
+#if defined(__linux__)
+    size_t lus = 0;
+    while (lus < n) {
+        ssize_t r = getrandom(o + lus, n - lus, 0);
+        if (r <= 0) break;
+        lus += (size_t)r;
+    }
+    if (lus == n) return 1;
+#endif
+    FILE *f = fopen("/dev/urandom", "rb");
+    if (f == NULL) return 0;
+    size_t r = fread(o, 1, n, f);
+    fclose(f);
+    return r == n;
+}
+
+int BigBinaryAlea_initSysteme(BigBinaryAlea *g, BigBinaryAleaType type) {
+    if (g == NULL) return 0;
+    unsigned char o[32];
+    if (octetsSysteme(o, sizeof(o))) {
+        initOctets(g, type, o);
+        return 1;
+    }
+
+    // Repli : horloge et adresse (différent d'un thread / d'un lancement à l'autre)
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    uint64_t graine = ((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec)
+                    ^ (uint64_t)(uintptr_t)g;
+    BigBinaryAlea_init(g, type, graine);
+    return 0;
+}
+
+/* Générateur par défaut du thread, préparé au premier usage */
+static _Thread_local BigBinaryAlea tl_alea;
+static _Thread_local int tl_aleaPret = 0;
+
+BigBinaryAlea *BigBinaryAlea_duThread(void) {
+    if (!tl_aleaPret) {
+        BigBinaryAlea_initSysteme(&tl_alea, BB_ALEA_CHACHA20);
+        tl_aleaPret = 1;
+    }
+    return &tl_alea;
+}
+
+/* ===========================================================
+ *  Tirage de mots
+ * =========================================================== */
+
+/**
+ * remplir - Écrit n mots pseudo-aléatoires dans m
+ *
+ * RÔLE : Chemin commun de tous les tirages. xoshiro produit les mots un
+ *   par un dans une boucle sans appel ; ChaCha20 copie son tampon par
+ *   paquets de 8 mots.
+ */
+static void remplir(BigBinaryAlea *g, uint64_t *m, int n) {
+    if (g->type == BB_ALEA_XOSHIRO) {
+        uint64_t s[4] = { g->s[0], g->s[1], g->s[2], g->s[3] };
+        for (int i = 0; i < n; ++i) m[i] = xoshiroSuivant(s);
+        memcpy(g->s, s, sizeof(s));
+        return;
+    }
+
+    int i = 0;
+    while (i < n) {
+        if (g->reste == 0) chachaBloc(g);
+        int k = n - i < g->reste ? n - i : g->reste;
+        memcpy(m + i, g->tampon + (8 - g->reste), (size_t)k * sizeof(uint64_t));
+        g->reste -= k;
+        i += k;
+    }
+}
+
+uint64_t BigBinaryAlea_mot(BigBinaryAlea *g) {
+    if (g == NULL) g = BigBinaryAlea_duThread();
+    uint64_t v;
+    remplir(g, &v, 1);
+    return v;
+}
+
+/* ===========================================================
+ *  Nombres aléatoires
+ * =========================================================== */
+
+/**
+ * BigBinary_random - Nombre uniforme dans [0, 2^bits[
+ *
+ * ALGORITHME : ⌈bits / 64⌉ mots tirés directement dans le nombre, puis
+ *   les bits au-delà de "bits" effacés dans le mot de tête.
+ *
+ * @param bits : Taille maximale en bits (≤ 0 → zéro)
+ * @param g : Générateur (NULL → générateur du thread)
+ * @return : Le nombre (normalisé, positif)
+ */
+BigBinary BigBinary_random(int bits, BigBinaryAlea *g) {
+    if (bits <= 0) return initBigBinary();
+    if (g == NULL) g = BigBinaryAlea_duThread();
+
+    int n = (bits + 63) / 64;
+    BigBinary A = bb_creer(n);
+    uint64_t *a = bb_mots(&A);
+    remplir(g, a, n);
+    if (bits % 64) a[n - 1] &= (1ULL << (bits % 64)) - 1;
+
+    normalizeBigBinary(&A);
+    return A;
+}
+
+/**
+ * BigBinary_randomBelow - Nombre uniforme dans [0, n[
+ *
+ * ALGORITHME : Tirage sur nbBits(n) bits, recommencé tant que le résultat
+ *   est ≥ n. Comme n ≥ 2^(nbBits − 1), chaque tirage réussit avec une
+ *   probabilité > 1/2 ; la comparaison s'arrête au premier mot qui diffère
+ *   (presque toujours le mot de tête). Le même tableau sert à tous les
+ *   tirages.
+ *
+ * @param n : La borne (doit être > 0)
+ * @param g : Générateur (NULL → générateur du thread)
+ * @return : Le nombre (normalisé, positif)
+ */
+BigBinary BigBinary_randomBelow(const BigBinary n, BigBinaryAlea *g) {
+    if (estZero(n) || n.Signe) {
+        fprintf(stderr, "Erreur: borne nulle ou negative dans BigBinary_randomBelow\n");
+        return initBigBinary();
+    }
+    if (g == NULL) g = BigBinaryAlea_duThread();
+
+    const uint64_t *b = bb_motsC(&n);
+    int nm = bb_motsUtiles(&n);
+    int bitsTete = 64 - bb_clz64(b[nm - 1]);
+    uint64_t masque = bitsTete == 64 ? ~0ULL : (1ULL << bitsTete) - 1;
+
+    BigBinary A = bb_creer(nm);
+    uint64_t *a = bb_mots(&A);
+    for (;;) {
+        remplir(g, a, nm);
+        a[nm - 1] &= masque;
+
+        int i = nm - 1;
+        while (i >= 0 && a[i] == b[i]) i--;
+        if (i >= 0 && a[i] < b[i]) break;   // a < n (a == n est rejeté)
+    }
+
+    normalizeBigBinary(&A);
+    return A;
+}
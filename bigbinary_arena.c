@@ -0,0 +1,287 @@
+#include "bigbinary_interne.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * ============================================================================
+ * ARÈNES D'ALLOCATION POUR LES TEMPORAIRES BIGBINARY
+ * ============================================================================
+ *
+ * Chaque opération alloue puis libère de nombreux tableaux Tdigits (par ex.
+ * BigBinary_mul_mod en crée plusieurs par bit du multiplicateur). Avec
+ * plusieurs threads, tous ces malloc/free se disputent l'allocateur.
+ *
+ * Une arène regroupe :
+ *   - des "morceaux" de mémoire découpés par simple incrément (bump) ;
+ *   - une liste de blocs libres par classe de taille (puissances de 2),
+ *     pour recycler immédiatement ce que libereBigBinary() rend ;
+ * et se vide d'un seul coup (BigBinaryArena_vider).
+ *
+ * Une arène n'appartient qu'à un thread à la fois : aucun verrou.
+ * ============================================================================
+ */
+
+/* Classes : 16 o, 32 o, ..., 1 Mio (en-tête compris). Au-delà → tas. */
+#define CLASSE_MIN_LOG2  4
+#define NB_CLASSES       17
+#define CLASSE_TAS       ((size_t)-1)
+
+#define TAILLE_MORCEAU_DEFAUT  (64 * 1024)
+
+/* En-tête placé devant chaque bloc rendu par bb_allouer() */
+typedef struct {
+    BigBinaryArena *arena;   // NULL si le bloc vient du tas
+    size_t classe;           // classe de taille, ou CLASSE_TAS
+} EnteteBloc;
+
+/* Morceau de mémoire découpé par incrément */
+typedef struct Morceau {
+    struct Morceau *suivant;
+    size_t taille;           // octets utilisables après l'en-tête du morceau
+} Morceau;
+
+/* Bloc libre chaîné dans sa classe (réutilise la place des données) */
+typedef struct BlocLibre {
+    struct BlocLibre *suivant;
+} BlocLibre;
+
+struct BigBinaryArena {
+    Morceau *morceaux;        // liste des morceaux (le courant en tête)
+    char *pos;                // prochain octet libre du morceau courant
+    char *fin;                // fin du morceau courant
+    size_t tailleMorceau;     // taille d'un nouveau morceau
+    size_t totalMorceaux;     // somme des tailles (pour regrouper au vidage)
+    BlocLibre *libres[NB_CLASSES];
+};
+
+/* Arène active et arène par défaut du thread courant */
+static _Thread_local BigBinaryArena *tl_active = NULL;
+static _Thread_local BigBinaryArena *tl_defaut = NULL;
+
+/* Clé pthread : détruit l'arène par défaut quand le thread se termine */
+static pthread_key_t cleDefaut;
+static pthread_once_t cleUneFois = PTHREAD_ONCE_INIT;
+
+static void detruireDefaut(void *arena) {
+    BigBinaryArena_detruire((BigBinaryArena*)arena);
+}
+
+static void creerCle(void) {
+    pthread_key_create(&cleDefaut, detruireDefaut);
+}
+
+/* ===========================================================
+ *  Gestion des morceaux
+ * =========================================================== */
+
+static int ajouterMorceau(BigBinaryArena *A, size_t minimum) {
+    size_t taille = A->tailleMorceau;
+    if (taille < minimum) taille = minimum;
+
+    Morceau *m = (Morceau*)malloc(sizeof(Morceau) + taille);
+    if (m == NULL) return 0;
+    m->taille = taille;
+    m->suivant = A->morceaux;
+    A->morceaux = m;
+    A->totalMorceaux += taille;
+
+    A->pos = (char*)(m + 1);
+    A->fin = A->pos + taille;
+    return 1;
+}
+
+/* Classe de taille pour un bloc de n octets (en-tête compris) */
+static size_t classeDe(size_t n) {
+    size_t c = 0;
+    size_t t = (size_t)1 << CLASSE_MIN_LOG2;
+    while (t < n) {
+        t <<= 1;
+        c++;
+    }
+    return c;
+}
+
+static size_t tailleClasse(size_t c) {
+    return (size_t)1 << (c + CLASSE_MIN_LOG2);
+}
+
+/* ===========================================================
+ *  API publique
+ * =========================================================== */
+
+/**
+ * BigBinaryArena_creer - Crée une arène vide
+ *
+ * @param tailleMorceau : Taille des morceaux (0 → 64 Kio)
+ * @return : La nouvelle arène (NULL si mémoire insuffisante)
+ */
+BigBinaryArena *BigBinaryArena_creer(size_t tailleMorceau) {
+    BigBinaryArena *A = (BigBinaryArena*)calloc(1, sizeof(BigBinaryArena));
+    if (A == NULL) return NULL;
+    A->tailleMorceau = tailleMorceau ? tailleMorceau : TAILLE_MORCEAU_DEFAUT;
+    return A;
+}
+
+/**
+ * BigBinaryArena_vider - Libère en bloc tout ce qui a été alloué
+ *
+ * Les morceaux sont regroupés en un seul, assez grand pour la charge
+ * observée : les portées suivantes n'appellent plus malloc du tout.
+ */
+void BigBinaryArena_vider(BigBinaryArena *A) {
+    if (A == NULL) return;
+
+    memset(A->libres, 0, sizeof(A->libres));
+
+    // Un seul morceau : il suffit de revenir au début
+    if (A->morceaux != NULL && A->morceaux->suivant == NULL) {
+        A->pos = (char*)(A->morceaux + 1);
+        A->fin = A->pos + A->morceaux->taille;
+        return;
+    }
+
+    // Plusieurs morceaux : les remplacer par un seul de taille totale
+    size_t total = A->totalMorceaux;
+    Morceau *m = A->morceaux;
+    while (m != NULL) {
+        Morceau *s = m->suivant;
+        free(m);
+        m = s;
+    }
+    A->morceaux = NULL;
+    A->pos = A->fin = NULL;
+    A->totalMorceaux = 0;
+    if (total > A->tailleMorceau) A->tailleMorceau = total;
+}
+
+/**
+ * BigBinaryArena_detruire - Rend toute la mémoire de l'arène au système
+ */
+void BigBinaryArena_detruire(BigBinaryArena *A) {
+    if (A == NULL) return;
+    if (tl_active == A) tl_active = NULL;
+    if (tl_defaut == A) tl_defaut = NULL;
+
+    Morceau *m = A->morceaux;
+    while (m != NULL) {
+        Morceau *s = m->suivant;
+        free(m);
+        m = s;
+    }
+    free(A);
+}
+
+/**
+ * BigBinaryArena_activer - Choisit l'arène des allocations du thread
+ *
+ * @param A : L'arène à utiliser (NULL → retour au tas)
+ * @return : L'arène active précédente (pour la restaurer)
+ */
+BigBinaryArena *BigBinaryArena_activer(BigBinaryArena *A) {
+    BigBinaryArena *prec = tl_active;
+    tl_active = A;
+    return prec;
+}
+
+/**
+ * BigBinaryArena_duThread - Arène par défaut du thread courant
+ *
+ * Créée au premier appel, détruite automatiquement à la fin du thread.
+ */
+BigBinaryArena *BigBinaryArena_duThread(void) {
+    if (tl_defaut == NULL) {
+        pthread_once(&cleUneFois, creerCle);
+        tl_defaut = BigBinaryArena_creer(0);
+        pthread_setspecific(cleDefaut, tl_defaut);
+    }
+    return tl_defaut;
+}
+
+/* ===========================================================
+ *  Allocation interne
+ * =========================================================== */
+
+void *bb_allouer(size_t octets) {
+    size_t besoin = octets + sizeof(EnteteBloc);
+    size_t c = classeDe(besoin);
+    BigBinaryArena *A = tl_active;
+    EnteteBloc *h;
+
+    BB_STAT_ALLOC(octets, A == NULL || c >= NB_CLASSES);
+
+    if (A == NULL || c >= NB_CLASSES) {
+        // Pas d'arène ou bloc trop gros : tas
+        h = (EnteteBloc*)malloc(besoin);
+        if (h == NULL) return NULL;
+        h->arena = NULL;
+        h->classe = CLASSE_TAS;
+        return h + 1;
+    }
+
+    if (A->libres[c] != NULL) {
+        // Recycler un bloc libéré de la même classe
+        h = (EnteteBloc*)A->libres[c];
+        A->libres[c] = ((BlocLibre*)h)->suivant;
+    } else {
+        // Découper la suite du morceau courant
+        size_t t = tailleClasse(c);
+        if (A->pos == NULL || (size_t)(A->fin - A->pos) < t) {
+            if (!ajouterMorceau(A, t)) return NULL;
+        }
+        h = (EnteteBloc*)A->pos;
+        A->pos += t;
+    }
+
+    h->arena = A;
+    h->classe = c;
+    return h + 1;
+}
+
+void *bb_allouerZero(size_t octets) {
+    void *p = bb_allouer(octets);
+    if (p != NULL) memset(p, 0, octets);
+    return p;
+}
+
+void bb_liberer(void *p) {
+    if (p == NULL) return;
+    EnteteBloc *h = (EnteteBloc*)p - 1;
+
+    if (h->arena == NULL) {
+        free(h);
+        return;
+    }
+
+    // Bloc d'arène : on le remet dans la liste de sa classe
+    BigBinaryArena *A = h->arena;
+    size_t c = h->classe;
+    ((BlocLibre*)h)->suivant = A->libres[c];
+    A->libres[c] = (BlocLibre*)h;
+}
+
+/* ===========================================================
+ *  Portées de calcul
+ * =========================================================== */
+
+BBPortee bb_porteeOuvrir(void) {
+    BBPortee p;
+    p.ouverte = 0;
+    if (tl_active == NULL) {
+        tl_active = BigBinaryArena_duThread();
+        p.ouverte = (tl_active != NULL);
+    }
+    return p;
+}
+
+BigBinary bb_porteeFermer(BBPortee p, BigBinary resultat) {
+    if (!p.ouverte) return resultat;
+
+    // Recopier le résultat sur le tas, puis tout vider d'un coup
+    BigBinaryArena *A = tl_active;
+    tl_active = NULL;
+    BigBinary R = copieBigBinary(resultat);
+    BigBinaryArena_vider(A);
+    return R;
+}
@@ -0,0 +1,211 @@
+#include "bigbinary_interne.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * ============================================================================
+ * EXPONENTIATION À BASE FIXE (PEIGNE DE LIM–LEE)
+ * ============================================================================
+ *
+ * Générateur Diffie–Hellman, valeurs d'aveuglement : la base g et le
+ * module ne changent pas, seul l'exposant varie. Les carrés de g peuvent
+ * donc être calculés une fois pour toutes.
+ *
+ * L'exposant (au plus L bits) est vu comme un tableau de h lignes de
+ * a = ⌈L/h⌉ bits (les "dents" du peigne), chaque ligne coupée en v blocs
+ * de b = ⌈a/v⌉ bits :
+ *
+ *   bit (i, j, k) = bit i·a + j·b + k de e    (ligne i, bloc j, colonne k)
+ *
+ *   G[j][u] = ∏ g^(2^(i·a + j·b))  pour les bits i de u   (u < 2^h)
+ *
+ * Pour k = b-1 … 0 : un carré, puis pour chaque bloc j une multiplication
+ * par G[j][u], u formé des h bits (·, j, k). Coût : b carrés et v·b
+ * multiplications au plus, au lieu de L carrés pour un expMod.
+ *
+ *   dents h   blocs v   table (entrées)   carrés (L = 2048)
+ *      8         2          512                 128
+ *      8         4         1024                  64
+ *
+ * Tout est en représentation de Montgomery (module impair). Les constantes
+ * du module viennent du cache (bb_moduleObtenir) : l'objet garde sa
+ * référence jusqu'à BigBinaryFixedBase_detruire(). Une fois créé, l'objet
+ * n'est plus modifié : plusieurs threads peuvent l'utiliser en même temps.
+ * ============================================================================
+ */
+
+#define DENTS_DEFAUT   8
+#define BLOCS_DEFAUT   2
+#define DENTS_MAX      16
+
+struct BigBinaryFixedBase {
+    BigBinary g, mod;                   // copies (tas), pour le repli sur BigBinary_expMod
+    int montgomery;                     // 0 : module pair ou 1 → BigBinary_expMod
+    const BBContexteModule *ctx;        // référence sur le cache des modules
+    int n;                              // mots du module
+    int bitsMax;                        // L
+    int h, v, a, b;
+    uint64_t *table;                    // G[j][u] en (j·2^h + u)·n, u = 0 inutilisé
+};
+
+/* Copie sur le tas (l'objet survit aux arènes et portées de l'appelant) */
+static BigBinary copieTas(const BigBinary A) {
+    BigBinaryArena *prec = BigBinaryArena_activer(NULL);
+    BigBinary C = copieBigBinary(A);
+    normalizeBigBinary(&C);
+    BigBinaryArena_activer(prec);
+    return C;
+}
+
+/* Case G[j][u] */
+static uint64_t *caseTable(const BigBinaryFixedBase *B, int j, int u) {
+    return B->table + (((size_t)j << B->h) + (size_t)u) * B->n;
+}
+
+/**
+ * precalculer - Remplit G[j][u] (une fois, à la création)
+ *
+ * ÉTAPE 1 : G[0][2^i] = g~^(2^(i·a)) par a carrés successifs
+ * ÉTAPE 2 : G[0][u] = G[0][u sans son bit de poids faible] × G[0][ce bit]
+ * ÉTAPE 3 : G[j][u] = G[j-1][u]^(2^b)
+ */
+static void precalculer(BigBinaryFixedBase *B) {
+    const BBMontgomery *mont = &B->ctx->mont;
+    int n = B->n;
+    size_t octets = (size_t)n * sizeof(uint64_t);
+    uint64_t *t = (uint64_t*)bb_allouer((size_t)(n + 2) * sizeof(uint64_t));
+
+    // g mod N puis g~
+    BigBinary r = BigBinary_mod(B->g, B->mod);
+    uint64_t *p = (uint64_t*)bb_allouerZero(octets);
+    memcpy(p, bb_motsC(&r), (size_t)bb_motsUtiles(&r) * sizeof(uint64_t));
+    libereBigBinary(&r);
+    bb_montMul(mont, p, p, mont->R2, t);
+
+    // ÉTAPE 1 : une puissance de g par dent
+    for (int i = 0; i < B->h; ++i) {
+        memcpy(caseTable(B, 0, 1 << i), p, octets);
+        if (i + 1 < B->h)
+            for (int c = 0; c < B->a; ++c) bb_montMul(mont, p, p, p, t);
+    }
+
+    // ÉTAPE 2 : toutes les combinaisons de dents
+    for (int u = 3; u < (1 << B->h); ++u) {
+        int bas = u & -u;
+        if (bas == u) continue;
+        bb_montMul(mont, caseTable(B, 0, u), caseTable(B, 0, u ^ bas), caseTable(B, 0, bas), t);
+    }
+
+    // ÉTAPE 3 : blocs suivants, décalés de b carrés
+    for (int j = 1; j < B->v; ++j) {
+        for (int u = 1; u < (1 << B->h); ++u) {
+            uint64_t *c = caseTable(B, j, u);
+            memcpy(c, caseTable(B, j - 1, u), octets);
+            for (int k = 0; k < B->b; ++k) bb_montMul(mont, c, c, c, t);
+        }
+    }
+
+    bb_liberer(p);
+    bb_liberer(t);
+}
+
+/* ===========================================================
+ *  API publique
+ * =========================================================== */
+
+BigBinaryFixedBase *BigBinaryFixedBase_creer(const BigBinary g, const BigBinary mod,
+                                             int bitsExposant, int dents, int blocs) {
+    if (estZero(mod)) {
+        fprintf(stderr, "Erreur: mod nul dans BigBinaryFixedBase_creer\n");
+        return NULL;
+    }
+
+    BigBinaryFixedBase *B = (BigBinaryFixedBase*)calloc(1, sizeof(BigBinaryFixedBase));
+    B->g = copieTas(g);
+    B->mod = copieTas(mod);
+    B->n = bb_motsUtiles(&B->mod);
+
+    // CAS 1 : Montgomery impossible (module pair) ou inutile (module 1)
+    B->montgomery = !estPair(mod) && !(B->n == 1 && bb_motsC(&B->mod)[0] == 1);
+    if (!B->montgomery) return B;
+
+    // CAS 2 : Géométrie du peigne
+    B->bitsMax = bitsExposant > 0 ? bitsExposant : BigBinary_nbBits(mod);
+    B->h = dents > 0 ? dents : DENTS_DEFAUT;
+    if (B->h > DENTS_MAX) B->h = DENTS_MAX;
+    if (B->h > B->bitsMax) B->h = B->bitsMax;
+    B->a = (B->bitsMax + B->h - 1) / B->h;
+    B->v = blocs > 0 ? blocs : BLOCS_DEFAUT;
+    if (B->v > B->a) B->v = B->a;
+    B->b = (B->a + B->v - 1) / B->v;
+
+    // CAS 3 : Table sur le tas, remplie une fois
+    B->ctx = bb_moduleObtenir(bb_motsC(&B->mod), B->n);
+    B->table = (uint64_t*)malloc(((size_t)B->v << B->h) * B->n * sizeof(uint64_t));
+    precalculer(B);
+    return B;
+}
+
+BigBinary BigBinaryFixedBase_expMod(const BigBinaryFixedBase *B, const BigBinary exp) {
+    // CAS 1 : Pas de table, ou exposant plus long que prévu → calcul général
+    if (!B->montgomery || BigBinary_nbBits(exp) > B->bitsMax)
+        return BigBinary_expMod(B->g, exp, B->mod);
+
+    BB_STAT_DEBUT(BB_PRIM_EXPMOD);
+    const BBMontgomery *mont = &B->ctx->mont;
+    int n = B->n;
+    size_t octets = (size_t)n * sizeof(uint64_t);
+
+    BBPortee portee = bb_porteeOuvrir();
+    uint64_t *acc = (uint64_t*)bb_allouer(octets);
+    uint64_t *un = (uint64_t*)bb_allouerZero(octets);
+    uint64_t *t = (uint64_t*)bb_allouer((size_t)(n + 2) * sizeof(uint64_t));
+    un[0] = 1;
+
+    // CAS 2 : Colonnes de gauche à droite ; pas de carré tant que acc vaut 1
+    int vide = 1;
+    for (int k = B->b - 1; k >= 0; --k) {
+        if (!vide) bb_montMul(mont, acc, acc, acc, t);
+        for (int j = B->v - 1; j >= 0; --j) {
+            int col = j * B->b + k;
+            if (col >= B->a) continue;   // dernier bloc plus court
+            int u = 0;
+            for (int i = 0; i < B->h; ++i) u |= bb_bit(&exp, i * B->a + col) << i;
+            if (u == 0) continue;
+            if (vide) memcpy(acc, caseTable(B, j, u), octets);
+            else bb_montMul(mont, acc, acc, caseTable(B, j, u), t);
+            vide = 0;
+        }
+    }
+
+    // Sortie de la représentation de Montgomery (exposant nul : 1)
+    BigBinary R = bb_creer(n);
+    if (vide) bb_mots(&R)[0] = 1;
+    else bb_montMul(mont, bb_mots(&R), acc, un, t);
+    normalizeBigBinary(&R);
+
+    bb_liberer(t);
+    bb_liberer(un);
+    bb_liberer(acc);
+    BB_STAT_FIN(BB_PRIM_EXPMOD, n);
+    return bb_porteeFermer(portee, R);
+}
+
+size_t BigBinaryFixedBase_taille(const BigBinaryFixedBase *B) {
+    if (B == NULL || !B->montgomery) return 0;
+    return ((size_t)B->v << B->h) * B->n * sizeof(uint64_t);
+}
+
+void BigBinaryFixedBase_detruire(BigBinaryFixedBase *B) {
+    if (B == NULL) return;
+    if (B->montgomery) {
+        free(B->table);
+        bb_moduleRendre(B->ctx);
+    }
+    BigBinaryArena *prec = BigBinaryArena_activer(NULL);
+    libereBigBinary(&B->g);
+    libereBigBinary(&B->mod);
+    BigBinaryArena_activer(prec);
+    free(B);
+}
@@ -0,0 +1,400 @@
+/*
+ * ============================================================================
+ * BANC DE MESURE DE LA BIBLIOTHÈQUE BIGBINARY
+ * ============================================================================
+ *
+ * Mesure chaque opération sur des opérandes de 64 bits à 1 Mbit (tailles
+ * doublées à chaque palier) :
+ *   add, sub, cmp, shl, shr, mod, pgcd, expmod, rsa_enc, rsa_dec
+ *
+ * Pour chaque (opération, taille) :
+ *   1. échauffement, qui sert aussi à calibrer un "lot" d'appels tel qu'un
+ *      échantillon dure au moins ~20 µs (les petites opérations sont trop
+ *      courtes pour être chronométrées une par une) ;
+ *   2. N échantillons chronométrés (ou moins si le budget de temps est
+ *      épuisé, au minimum 3) ;
+ *   3. médiane, p99, min et max du temps par appel.
+ *
+ * Les opérandes sont tirés d'un générateur pseudo-aléatoire à graine fixe :
+ * deux exécutions mesurent exactement les mêmes calculs.
+ *
+ * UTILISATION :
+ *   bigbinary_bench [--op nom[,nom...]] [--min-bits N] [--max-bits N]
+ *                   [--reps N] [--warmup N] [--budget secondes]
+ *                   [--format texte|csv|json] [--out fichier] [--seed N]
+ *
+ * Les opérations quadratiques ou pires ont une taille maximale par défaut
+ * plus petite (voir OPERATIONS) ; --max-bits la remplace pour toutes.
+ * ============================================================================
+ */
+
+#include "bigbinary.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BITS_MIN_DEFAUT   64
+#define BITS_MAX_ABSOLU   (1 << 20)   // 1 Mbit
+#define ECHANTILLON_NS    20000.0     // durée visée d'un échantillon
+
+/* ===========================================================
+ *  Générateur pseudo-aléatoire (xoshiro256** de la bibliothèque) et opérandes
+ * =========================================================== */
+
+#define GRAINE_DEFAUT 0x9E3779B97F4A7C15ULL
+
+static BigBinaryAlea alea;
+
+/* Nombre aléatoire d'exactement "bits" bits (bit de tête à 1), impair si demandé */
+static BigBinary aleaBigBinary(int bits, int impair) {
+    size_t n = ((size_t)bits + 7) / 8;
+    unsigned char *o = (unsigned char*)malloc(n);
+    for (size_t i = 0; i < n; i += 8) {
+        uint64_t v = BigBinaryAlea_mot(&alea);
+        for (size_t k = 0; k < 8 && i + k < n; ++k) o[i + k] = (unsigned char)(v >> (8 * k));
+    }
+
+    int excedent = (int)(n * 8) - bits;          // bits en trop dans le 1er octet
+    o[0] &= (unsigned char)(0xFF >> excedent);
+    o[0] |= (unsigned char)(0x80 >> excedent);   // force le bit de tête
+    if (impair) o[n - 1] |= 1;
+
+    BigBinary A = initBigBinaryFromBytes(o, n);
+    free(o);
+    return A;
+}
+
+/* ===========================================================
+ *  Opérations mesurées
+ * =========================================================== */
+
+typedef struct {
+    BigBinary A, B, M, E;   // opérandes préparés pour une taille donnée
+    int bits;
+} Operandes;
+
+typedef void (*Preparer)(Operandes *o, int bits);
+typedef void (*Executer)(const Operandes *o);
+
+/* A et B de même taille, A > B (soustraction valide) */
+static void prepDeux(Operandes *o, int bits) {
+    o->A = aleaBigBinary(bits, 0);
+    o->B = aleaBigBinary(bits - 1 > 0 ? bits - 1 : 1, 0);
+}
+
+/* A de 2×bits, B (diviseur) de bits */
+static void prepMod(Operandes *o, int bits) {
+    o->A = aleaBigBinary(2 * bits, 0);
+    o->B = aleaBigBinary(bits, 0);
+}
+
+/* Module impair de bits, base < module, exposant pleine taille */
+static void prepExp(Operandes *o, int bits) {
+    o->M = aleaBigBinary(bits, 1);
+    o->A = aleaBigBinary(bits - 1, 0);
+    o->E = aleaBigBinary(bits, 1);
+}
+
+/* RSA : exposant public 65537 */
+static void prepRsaEnc(Operandes *o, int bits) {
+    o->M = aleaBigBinary(bits, 1);
+    o->A = aleaBigBinary(bits - 1, 0);
+    o->E = initBigBinaryFromString("10000000000000001");
+}
+
+static void execAdd(const Operandes *o) {
+    BigBinary R = additionBigBinary(o->A, o->B);
+    libereBigBinary(&R);
+}
+
+static void execSub(const Operandes *o) {
+    BigBinary R = soustractionBigBinary(o->A, o->B);
+    libereBigBinary(&R);
+}
+
+static volatile int puitsCmp;  // empêche le compilateur de supprimer la comparaison
+
+static void execCmp(const Operandes *o) {
+    puitsCmp += Inferieur(o->A, o->B) + Egal(o->A, o->B);
+}
+
+static void execShl(const Operandes *o) {
+    BigBinary R = decaleGauche(o->A, 67);
+    libereBigBinary(&R);
+}
+
+static void execShr(const Operandes *o) {
+    BigBinary R = decaleDroite(o->A, 67);
+    libereBigBinary(&R);
+}
+
+static void execMod(const Operandes *o) {
+    BigBinary R = BigBinary_mod(o->A, o->B);
+    libereBigBinary(&R);
+}
+
+static void execPgcd(const Operandes *o) {
+    BigBinary R = pgcdBinaire(o->A, o->B);
+    libereBigBinary(&R);
+}
+
+static void execExp(const Operandes *o) {
+    BigBinary R = BigBinary_expMod(o->A, o->E, o->M);
+    libereBigBinary(&R);
+}
+
+static void execRsaEnc(const Operandes *o) {
+    BigBinary R = BigBinary_RSA_encrypt(o->A, o->E, o->M);
+    libereBigBinary(&R);
+}
+
+static void execRsaDec(const Operandes *o) {
+    BigBinary R = BigBinary_RSA_decrypt(o->A, o->E, o->M);
+    libereBigBinary(&R);
+}
+
+typedef struct {
+    const char *nom;
+    Preparer preparer;
+    Executer executer;
+    int maxBitsDefaut;      // au-delà, une mesure prendrait des minutes
+} Operation;
+
+static const Operation OPERATIONS[] = {
+    { "add",     prepDeux,   execAdd,    BITS_MAX_ABSOLU },
+    { "sub",     prepDeux,   execSub,    BITS_MAX_ABSOLU },
+    { "cmp",     prepDeux,   execCmp,    BITS_MAX_ABSOLU },
+    { "shl",     prepDeux,   execShl,    BITS_MAX_ABSOLU },
+    { "shr",     prepDeux,   execShr,    BITS_MAX_ABSOLU },
+    { "mod",     prepMod,    execMod,    1 << 16 },
+    { "pgcd",    prepDeux,   execPgcd,   1 << 14 },
+    { "expmod",  prepExp,    execExp,    2048 },
+    { "rsa_enc", prepRsaEnc, execRsaEnc, 1 << 14 },
+    { "rsa_dec", prepExp,    execRsaDec, 2048 },
+};
+#define NB_OPERATIONS ((int)(sizeof(OPERATIONS) / sizeof(OPERATIONS[0])))
+
+/* ===========================================================
+ *  Chronométrage et statistiques
+ * =========================================================== */
+
+static double maintenantNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static int comparerDoubles(const void *a, const void *b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/* Quantile q (0..1) d'un tableau trié (rang le plus proche) */
+static double quantile(const double *tri, int n, double q) {
+    int i = (int)(q * (n - 1) + 0.5);
+    if (i < 0) i = 0;
+    if (i >= n) i = n - 1;
+    return tri[i];
+}
+
+typedef struct {
+    const char *op;
+    int bits;
+    int echantillons;
+    long lot;
+    double medianeNs, p99Ns, minNs, maxNs;
+} Resultat;
+
+typedef struct {
+    int reps, warmup;
+    double budgetNs;
+} Reglages;
+
+static Resultat mesurer(const Operation *op, int bits, const Reglages *r) {
+    Operandes o;
+    memset(&o, 0, sizeof(o));
+    o.bits = bits;
+    op->preparer(&o, bits);
+
+    // Échauffement + calibrage du lot : on double jusqu'à ~20 µs par échantillon
+    long lot = 1;
+    for (int w = 0; w < r->warmup || w == 0; ++w) {
+        double t0 = maintenantNs();
+        for (long i = 0; i < lot; ++i) op->executer(&o);
+        double d = maintenantNs() - t0;
+        while (d < ECHANTILLON_NS && lot < (1L << 24)) {
+            lot *= 2;
+            t0 = maintenantNs();
+            for (long i = 0; i < lot; ++i) op->executer(&o);
+            d = maintenantNs() - t0;
+        }
+    }
+
+    // Échantillons chronométrés (temps par appel)
+    double *t = (double*)malloc((size_t)r->reps * sizeof(double));
+    int n = 0;
+    double debut = maintenantNs();
+    while (n < r->reps) {
+        double t0 = maintenantNs();
+        for (long i = 0; i < lot; ++i) op->executer(&o);
+        t[n++] = (maintenantNs() - t0) / (double)lot;
+        if (n >= 3 && maintenantNs() - debut > r->budgetNs) break;
+    }
+
+    qsort(t, (size_t)n, sizeof(double), comparerDoubles);
+
+    Resultat res;
+    res.op = op->nom;
+    res.bits = bits;
+    res.echantillons = n;
+    res.lot = lot;
+    res.medianeNs = quantile(t, n, 0.5);
+    res.p99Ns = quantile(t, n, 0.99);
+    res.minNs = t[0];
+    res.maxNs = t[n - 1];
+
+    free(t);
+    libereBigBinary(&o.A);
+    libereBigBinary(&o.B);
+    libereBigBinary(&o.M);
+    libereBigBinary(&o.E);
+    return res;
+}
+
+/* ===========================================================
+ *  Sorties : texte, CSV, JSON
+ * =========================================================== */
+
+enum { FORMAT_TEXTE, FORMAT_CSV, FORMAT_JSON };
+
+static void ecrireDebut(FILE *f, int format) {
+    if (format == FORMAT_CSV)
+        fprintf(f, "op,bits,echantillons,lot,mediane_ns,p99_ns,min_ns,max_ns\n");
+    else if (format == FORMAT_JSON)
+        fprintf(f, "[\n");
+    else
+        fprintf(f, "%-8s %8s %6s %8s %14s %14s %14s\n",
+                "op", "bits", "ech.", "lot", "mediane (ns)", "p99 (ns)", "min (ns)");
+}
+
+static void ecrireResultat(FILE *f, int format, const Resultat *r, int premier) {
+    if (format == FORMAT_CSV) {
+        fprintf(f, "%s,%d,%d,%ld,%.1f,%.1f,%.1f,%.1f\n", r->op, r->bits, r->echantillons,
+                r->lot, r->medianeNs, r->p99Ns, r->minNs, r->maxNs);
+    } else if (format == FORMAT_JSON) {
+        fprintf(f, "%s  {\"op\": \"%s\", \"bits\": %d, \"echantillons\": %d, \"lot\": %ld, "
+                   "\"mediane_ns\": %.1f, \"p99_ns\": %.1f, \"min_ns\": %.1f, \"max_ns\": %.1f}",
+                premier ? "" : ",\n", r->op, r->bits, r->echantillons, r->lot,
+                r->medianeNs, r->p99Ns, r->minNs, r->maxNs);
+    } else {
+        fprintf(f, "%-8s %8d %6d %8ld %14.1f %14.1f %14.1f\n", r->op, r->bits,
+                r->echantillons, r->lot, r->medianeNs, r->p99Ns, r->minNs);
+    }
+    fflush(f);
+}
+
+static void ecrireFin(FILE *f, int format) {
+    if (format == FORMAT_JSON) fprintf(f, "\n]\n");
+}
+
+/* ===========================================================
+ *  Programme principal
+ * =========================================================== */
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "Usage : %s [--op nom[,nom...]] [--min-bits N] [--max-bits N] [--reps N]\n"
+            "          [--warmup N] [--budget secondes] [--format texte|csv|json]\n"
+            "          [--out fichier] [--seed N] [--noyaux bmi2-adx|portable]\n"
+            "Operations :", prog);
+    for (int i = 0; i < NB_OPERATIONS; ++i) fprintf(stderr, " %s", OPERATIONS[i].nom);
+    fprintf(stderr, "\n");
+}
+
+/* 1 si "nom" figure dans la liste séparée par des virgules (NULL = toutes) */
+static int selectionnee(const char *liste, const char *nom) {
+    if (liste == NULL) return 1;
+    size_t n = strlen(nom);
+    const char *p = liste;
+    while (*p) {
+        const char *fin = strchr(p, ',');
+        size_t l = fin ? (size_t)(fin - p) : strlen(p);
+        if (l == n && strncmp(p, nom, n) == 0) return 1;
+        if (!fin) break;
+        p = fin + 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    const char *ops = NULL, *sortie = NULL;
+    int minBits = BITS_MIN_DEFAUT, maxBits = 0, format = FORMAT_TEXTE;
+    Reglages reg = { 21, 2, 2e9 };
+    BigBinaryAlea_init(&alea, BB_ALEA_XOSHIRO, GRAINE_DEFAUT);
+
+    for (int i = 1; i < argc; ++i) {
+        const char *a = argv[i];
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        const char *v = argv[++i];
+        if (strcmp(a, "--op") == 0) ops = v;
+        else if (strcmp(a, "--min-bits") == 0) minBits = atoi(v);
+        else if (strcmp(a, "--max-bits") == 0) maxBits = atoi(v);
+        else if (strcmp(a, "--reps") == 0) reg.reps = atoi(v);
+        else if (strcmp(a, "--warmup") == 0) reg.warmup = atoi(v);
+        else if (strcmp(a, "--budget") == 0) reg.budgetNs = atof(v) * 1e9;
+        else if (strcmp(a, "--out") == 0) sortie = v;
+        else if (strcmp(a, "--seed") == 0) BigBinaryAlea_init(&alea, BB_ALEA_XOSHIRO, strtoull(v, NULL, 0));
+        else if (strcmp(a, "--noyaux") == 0) {
+            if (!BigBinary_choisirNoyaux(v)) {
+                fprintf(stderr, "Erreur: noyaux %s indisponibles\n", v);
+                return 1;
+            }
+        } else if (strcmp(a, "--format") == 0) {
+            if (strcmp(v, "csv") == 0) format = FORMAT_CSV;
+            else if (strcmp(v, "json") == 0) format = FORMAT_JSON;
+            else format = FORMAT_TEXTE;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (reg.reps < 1) reg.reps = 1;
+    if (minBits < 2) minBits = 2;
+
+    FILE *f = stdout;
+    if (sortie != NULL && (f = fopen(sortie, "w")) == NULL) {
+        fprintf(stderr, "Erreur: impossible d'ouvrir %s\n", sortie);
+        return 1;
+    }
+
+    ecrireDebut(f, format);
+    int premier = 1;
+    for (int k = 0; k < NB_OPERATIONS; ++k) {
+        const Operation *op = &OPERATIONS[k];
+        if (!selectionnee(ops, op->nom)) continue;
+
+        int limite = maxBits > 0 ? maxBits : op->maxBitsDefaut;
+        if (limite > BITS_MAX_ABSOLU) limite = BITS_MAX_ABSOLU;
+
+        for (int bits = minBits; bits <= limite; bits *= 2) {
+            Resultat r = mesurer(op, bits, &reg);
+            ecrireResultat(f, format, &r, premier);
+            premier = 0;
+        }
+    }
+    ecrireFin(f, format);
+
+    // Bibliothèque compilée avec BIGBINARY_INSTRUMENTATION : compteurs sur stderr
+    if (BigBinaryStats_active()) {
+        BigBinaryStats stats;
+        BigBinaryStats_total(&stats);
+        BigBinaryStats_afficher(stderr, &stats);
+    }
+
+    if (f != stdout) fclose(f);
+    return 0;
+}
@@ -0,0 +1,377 @@
+#include "bigbinary_interne.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BB_BITS_X86 1
+#include <immintrin.h>
+#endif
+
+/*
+ * ============================================================================
+ * OPÉRATIONS BIT À BIT
+ * ============================================================================
+ *
+ * ET / OU / OU exclusif / complément, comptage de bits, accès à un bit et
+ * extraction de fenêtres, directement sur les mots de 64 bits : une
+ * instruction par mot, là où decaleGauche + BigBinary_mod coûteraient une
+ * passe complète par bit.
+ *
+ * Les signes sont ignorés : les opérations portent sur les valeurs
+ * absolues et rendent des nombres positifs (comme BigBinary_cmp).
+ *
+ * Les boucles sur tableaux existent en deux versions, choisies une fois au
+ * démarrage selon le CPU (même principe que bigbinary_noyaux.c) :
+ *   - portable : C pur, déroulé par 4 mots (le compilateur peut vectoriser) ;
+ *   - avx2     : registres de 256 bits (4 mots par instruction) et popcnt.
+ * ============================================================================
+ */
+
+/* ===========================================================
+ *  Noyaux portables
+ * =========================================================== */
+
+/* r[i] = a[i] OP b[i] pour i < n ; r peut être a ou b */
+#define BB_LOGIQUE_PORTABLE(nom, OP)                                            \
+    static void nom(uint64_t *r, const uint64_t *a, const uint64_t *b, int n) { \
+        int i = 0;                                                              \
+        for (; i + 4 <= n; i += 4) {                                            \
+            uint64_t x0 = a[i] OP b[i], x1 = a[i + 1] OP b[i + 1];              \
+            uint64_t x2 = a[i + 2] OP b[i + 2], x3 = a[i + 3] OP b[i + 3];      \
+            r[i] = x0; r[i + 1] = x1; r[i + 2] = x2; r[i + 3] = x3;             \
+        }                                                                       \
+        for (; i < n; ++i) r[i] = a[i] OP b[i];                                 \
+    }
+
+BB_LOGIQUE_PORTABLE(etPortable, &)
+BB_LOGIQUE_PORTABLE(ouPortable, |)
+BB_LOGIQUE_PORTABLE(ouexPortable, ^)
+
+static void nonPortable(uint64_t *r, const uint64_t *a, int n) {
+    for (int i = 0; i < n; ++i) r[i] = ~a[i];
+}
+
+/* Quatre compteurs indépendants : les popcount successifs ne s'attendent pas */
+static long long popcountPortable(const uint64_t *a, int n) {
+    long long c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        c0 += __builtin_popcountll(a[i]);
+        c1 += __builtin_popcountll(a[i + 1]);
+        c2 += __builtin_popcountll(a[i + 2]);
+        c3 += __builtin_popcountll(a[i + 3]);
+    }
+    for (; i < n; ++i) c0 += __builtin_popcountll(a[i]);
+    return c0 + c1 + c2 + c3;
+}
+
+static int dispoPortable(void) {
+    return 1;
+}
+
+/* ===========================================================
+ *  Noyaux AVX2
+ * =========================================================== */
+
+#ifdef BB_BITS_X86
+
+#define BB_LOGIQUE_AVX2(nom, INSTR, OP)                                         \
+    __attribute__((target("avx2")))                                             \
+    static void nom(uint64_t *r, const uint64_t *a, const uint64_t *b, int n) { \
+        int i = 0;                                                              \
+        for (; i + 4 <= n; i += 4) {                                            \
+            __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));            \
+            __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));            \
+            _mm256_storeu_si256((__m256i*)(r + i), INSTR(x, y));                \
+        }                                                                       \
+        for (; i < n; ++i) r[i] = a[i] OP b[i];                                 \
+    }
+
+BB_LOGIQUE_AVX2(etAvx2, _mm256_and_si256, &)
+BB_LOGIQUE_AVX2(ouAvx2, _mm256_or_si256, |)
+BB_LOGIQUE_AVX2(ouexAvx2, _mm256_xor_si256, ^)
+
+__attribute__((target("avx2")))
+static void nonAvx2(uint64_t *r, const uint64_t *a, int n) {
+    const __m256i uns = _mm256_set1_epi64x(-1);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        _mm256_storeu_si256((__m256i*)(r + i), _mm256_xor_si256(x, uns));
+    }
+    for (; i < n; ++i) r[i] = ~a[i];
+}
+
+/* popcnt matériel (un mot par cycle par unité), quatre chaînes indépendantes */
+__attribute__((target("popcnt")))
+static long long popcountMateriel(const uint64_t *a, int n) {
+    long long c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        c0 += (long long)_mm_popcnt_u64(a[i]);
+        c1 += (long long)_mm_popcnt_u64(a[i + 1]);
+        c2 += (long long)_mm_popcnt_u64(a[i + 2]);
+        c3 += (long long)_mm_popcnt_u64(a[i + 3]);
+    }
+    for (; i < n; ++i) c0 += (long long)_mm_popcnt_u64(a[i]);
+    return c0 + c1 + c2 + c3;
+}
+
+static int dispoAvx2(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+}
+
+#endif /* BB_BITS_X86 */
+
+/* ===========================================================
+ *  Choix des noyaux
+ * =========================================================== */
+
+typedef struct {
+    const char *nom;
+    void (*et)(uint64_t *r, const uint64_t *a, const uint64_t *b, int n);
+    void (*ou)(uint64_t *r, const uint64_t *a, const uint64_t *b, int n);
+    void (*ouex)(uint64_t *r, const uint64_t *a, const uint64_t *b, int n);
+    void (*non)(uint64_t *r, const uint64_t *a, int n);
+    long long (*popcount)(const uint64_t *a, int n);
+    int (*disponible)(void);
+} NoyauxBits;
+
+/* Du plus rapide au plus lent : le premier disponible est retenu */
+static const NoyauxBits NOYAUX_BITS[] = {
+#ifdef BB_BITS_X86
+    { "avx2", etAvx2, ouAvx2, ouexAvx2, nonAvx2, popcountMateriel, dispoAvx2 },
+#endif
+    { "portable", etPortable, ouPortable, ouexPortable, nonPortable, popcountPortable,
+      dispoPortable },
+};
+
+#define NB_NOYAUX_BITS ((int)(sizeof(NOYAUX_BITS) / sizeof(NOYAUX_BITS[0])))
+
+static const NoyauxBits *noyauxBitsActifs = NULL;
+static pthread_once_t noyauxBitsUneFois = PTHREAD_ONCE_INIT;
+
+static void detecterNoyauxBits(void) {
+    for (int i = 0; i < NB_NOYAUX_BITS; ++i) {
+        if (NOYAUX_BITS[i].disponible()) {
+            noyauxBitsActifs = &NOYAUX_BITS[i];
+            return;
+        }
+    }
+}
+
+static const NoyauxBits *noyauxBits(void) {
+    pthread_once(&noyauxBitsUneFois, detecterNoyauxBits);
+    return noyauxBitsActifs;
+}
+
+const char *BigBinary_noyauxBits(void) {
+    return noyauxBits()->nom;
+}
+
+int BigBinary_choisirNoyauxBits(const char *nom) {
+    noyauxBits();   // détection faite avant de la remplacer
+    for (int i = 0; i < NB_NOYAUX_BITS; ++i) {
+        if (strcmp(NOYAUX_BITS[i].nom, nom) == 0 && NOYAUX_BITS[i].disponible()) {
+            noyauxBitsActifs = &NOYAUX_BITS[i];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* ===========================================================
+ *  ET / OU / OU exclusif
+ * =========================================================== */
+
+typedef enum { OP_ET, OP_OU, OP_OUEX } OpLogique;
+
+/**
+ * logiqueEnPlace - A = |A| op |B|, dans le stockage de A
+ *
+ * ALGORITHME :
+ *   ÉTAPE 1 : Longueur du résultat : min(na, nb) pour ET (les mots au-delà
+ *             valent 0), max(na, nb) pour OU / OU exclusif.
+ *   ÉTAPE 2 : Noyau sur les min(na, nb) mots communs.
+ *   ÉTAPE 3 : OU / OU exclusif : les mots restants sont ceux du plus long
+ *             (déjà en place si c'est A, recopiés de B sinon).
+ *
+ * B peut être A lui-même (mêmes mots) : la croissance n'a lieu que si B
+ * est plus long que A, donc jamais dans ce cas.
+ */
+static void logiqueEnPlace(BigBinary *A, const BigBinary *B, OpLogique op) {
+    const NoyauxBits *k = noyauxBits();
+    int na = bb_motsUtiles(A), nb = bb_motsUtiles(B);
+    int commun = na < nb ? na : nb;
+
+    // ÉTAPE 1 : Longueur du résultat (et place pour les mots de B)
+    int nr = (op == OP_ET) ? commun : (na > nb ? na : nb);
+    if (nr > A->Capacite) bb_reserver(A, nr);
+    uint64_t *a = bb_mots(A);
+    const uint64_t *b = bb_motsC(B);
+
+    // ÉTAPE 2 : Mots communs
+    if (op == OP_ET) k->et(a, a, b, commun);
+    else if (op == OP_OU) k->ou(a, a, b, commun);
+    else k->ouex(a, a, b, commun);
+
+    // ÉTAPE 3 : Mots restants de B (OU / OU exclusif avec 0 : copie)
+    if (op != OP_ET && nb > na) memcpy(a + na, b + na, (size_t)(nb - na) * sizeof(uint64_t));
+
+    A->Taille = nr;
+    A->Signe = 0;
+    A->Normalise = 0;
+    normalizeBigBinary(A);
+}
+
+/** Copie de A (en valeur absolue) assez grande pour le résultat, puis opération en place */
+static BigBinary logique(const BigBinary A, const BigBinary B, OpLogique op) {
+    int na = bb_motsUtiles(&A), nb = bb_motsUtiles(&B);
+    int nr = (op == OP_ET) ? (na < nb ? na : nb) : (na > nb ? na : nb);
+
+    BigBinary R = bb_creer(nr);
+    int n = na < nr ? na : nr;
+    memcpy(bb_mots(&R), bb_motsC(&A), (size_t)n * sizeof(uint64_t));
+    R.Taille = n;
+    logiqueEnPlace(&R, &B, op);
+    return R;
+}
+
+/**
+ * BigBinary_and / BigBinary_or / BigBinary_xor - |A| op |B|
+ *
+ * EXEMPLE :
+ *   and(1100, 1010) = 1000, or(1100, 1010) = 1110, xor(1100, 1010) = 110
+ *
+ * @return : Nouveau BigBinary positif (normalisé)
+ */
+BigBinary BigBinary_and(const BigBinary A, const BigBinary B) {
+    return logique(A, B, OP_ET);
+}
+
+BigBinary BigBinary_or(const BigBinary A, const BigBinary B) {
+    return logique(A, B, OP_OU);
+}
+
+BigBinary BigBinary_xor(const BigBinary A, const BigBinary B) {
+    return logique(A, B, OP_OUEX);
+}
+
+void BigBinary_andEnPlace(BigBinary *A, const BigBinary B) {
+    if (A != NULL) logiqueEnPlace(A, &B, OP_ET);
+}
+
+void BigBinary_orEnPlace(BigBinary *A, const BigBinary B) {
+    if (A != NULL) logiqueEnPlace(A, &B, OP_OU);
+}
+
+void BigBinary_xorEnPlace(BigBinary *A, const BigBinary B) {
+    if (A != NULL) logiqueEnPlace(A, &B, OP_OUEX);
+}
+
+/* ===========================================================
+ *  Complément
+ * =========================================================== */
+
+/**
+ * BigBinary_notEnPlace - A = (2^bits − 1) − |A| : complément sur "bits" bits
+ *
+ * RÔLE : Un grand nombre n'a pas de largeur propre : le complément se fait
+ *   sur la largeur demandée. Les bits de A au-delà de "bits" sont ignorés.
+ *
+ * @param bits : Largeur du complément (≤ 0 → A devient 0)
+ */
+void BigBinary_notEnPlace(BigBinary *A, int bits) {
+    if (A == NULL) return;
+    int nr = bits > 0 ? (bits + BB_BITS_MOT - 1) / BB_BITS_MOT : 0;
+    int na = bb_motsUtiles(A);
+    if (nr > A->Capacite) bb_reserver(A, nr);
+
+    // Mots absents de A : zéros, donc uns après complément
+    uint64_t *a = bb_mots(A);
+    if (nr > na) memset(a + na, 0, (size_t)(nr - na) * sizeof(uint64_t));
+    noyauxBits()->non(a, a, nr);
+    if (nr > 0 && bits % BB_BITS_MOT) a[nr - 1] &= (1ULL << (bits % BB_BITS_MOT)) - 1;
+
+    A->Taille = nr;
+    A->Signe = 0;
+    A->Normalise = 0;
+    normalizeBigBinary(A);
+}
+
+BigBinary BigBinary_not(const BigBinary A, int bits) {
+    int nr = bits > 0 ? (bits + BB_BITS_MOT - 1) / BB_BITS_MOT : 0;
+    int na = bb_motsUtiles(&A);
+    int n = na < nr ? na : nr;
+
+    BigBinary R = bb_creer(nr);
+    memcpy(bb_mots(&R), bb_motsC(&A), (size_t)n * sizeof(uint64_t));
+    R.Taille = n;
+    BigBinary_notEnPlace(&R, bits);
+    return R;
+}
+
+/* ===========================================================
+ *  Comptage et accès aux bits
+ * =========================================================== */
+
+int BigBinary_popcount(const BigBinary A) {
+    return (int)noyauxBits()->popcount(bb_motsC(&A), bb_motsUtiles(&A));
+}
+
+int BigBinary_testBit(const BigBinary A, int i) {
+    if (i < 0) return 0;
+    return bb_bit(&A, i);
+}
+
+/**
+ * BigBinary_setBit - Met le bit i de A à v (0 ou 1)
+ *
+ * RÔLE : A grandit si i dépasse sa taille (et v = 1) ; mettre à 0 le bit
+ *   de tête renormalise A. Le signe est conservé.
+ */
+void BigBinary_setBit(BigBinary *A, int i, int v) {
+    if (A == NULL || i < 0) return;
+    int m = i / BB_BITS_MOT;
+    uint64_t masque = 1ULL << (i % BB_BITS_MOT);
+
+    if (m >= A->Taille) {
+        if (!v) return;   // déjà 0
+        if (m + 1 > A->Capacite) bb_reserver(A, m + 1);
+        memset(bb_mots(A) + A->Taille, 0, (size_t)(m + 1 - A->Taille) * sizeof(uint64_t));
+        A->Taille = m + 1;
+    }
+
+    uint64_t *a = bb_mots(A);
+    if (v) a[m] |= masque;
+    else a[m] &= ~masque;
+    A->Normalise = 0;
+    normalizeBigBinary(A);
+    if (estZero(*A)) A->Signe = 0;
+}
+
+/* Position du bit à 1 le plus haut : nbBits − 1 (lzcnt du mot de tête), -1 pour 0 */
+int BigBinary_bitPoidsFort(const BigBinary A) {
+    int n = bb_motsUtiles(&A);
+    if (n == 0) return -1;
+    return (n - 1) * BB_BITS_MOT + (BB_BITS_MOT - 1 - bb_clz64(bb_motsC(&A)[n - 1]));
+}
+
+/* Position du bit à 1 le plus bas (tzcnt du premier mot non nul), -1 pour 0 */
+int BigBinary_bitPoidsFaible(const BigBinary A) {
+    const uint64_t *a = bb_motsC(&A);
+    int n = bb_motsUtiles(&A);
+    for (int i = 0; i < n; ++i)
+        if (a[i] != 0) return i * BB_BITS_MOT + bb_ctz64(a[i]);
+    return -1;
+}
+
+uint64_t BigBinary_extraireBits(const BigBinary A, int bas, int k) {
+    if (k > BB_BITS_MOT) {
+        fprintf(stderr, "Erreur: fenetre de %d bits dans BigBinary_extraireBits (64 au plus)\n", k);
+        return 0;
+    }
+    return bb_extraireBits(&A, bas, k);
+}
@@ -0,0 +1,197 @@
+#include "bigbinary_interne.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * ============================================================================
+ * CACHE DES CONTEXTES DE MODULE
+ * ============================================================================
+ *
+ * Un service RSA réutilise quelques clés des millions de fois : préparer
+ * le module à chaque appel (diviseur normalisé, R² mod N par une division
+ * longue, n0) est du travail perdu. Les contextes sont donc gardés dans
+ * une table de hachage (clé : les mots du module), bornée, avec éviction
+ * du moins récemment utilisé.
+ *
+ *   seaux[hache % NB_SEAUX] → chaîne de contextes de même seau
+ *   lruTete ↔ ... ↔ lruQueue : du plus récent au plus ancien
+ *
+ * Un verrou global protège la table ; un contexte publié n'est plus
+ * jamais modifié, ses utilisateurs le lisent donc sans verrou. Chaque
+ * bb_moduleObtenir() prend une référence : un contexte évincé pendant
+ * qu'un calcul l'utilise n'est libéré qu'au dernier bb_moduleRendre().
+ *
+ * Les contextes sont alloués sur le tas (arène désactivée pendant la
+ * préparation) : ils survivent aux portées et aux arènes des appelants.
+ * ============================================================================
+ */
+
+#define NB_SEAUX          64
+#define CAPACITE_DEFAUT   16
+
+static pthread_mutex_t verrouCache = PTHREAD_MUTEX_INITIALIZER;
+static BBContexteModule *seaux[NB_SEAUX];
+static BBContexteModule *lruTete = NULL, *lruQueue = NULL;
+static int nbContextes = 0;
+static int capacite = CAPACITE_DEFAUT;
+static unsigned long long nbSucces = 0, nbEchecs = 0;
+
+/* Mélange des mots du module (constante de Fibonacci, xor-décalage) */
+static uint64_t hacher(const uint64_t *N, int n) {
+    uint64_t h = (uint64_t)n;
+    for (int i = 0; i < n; ++i) {
+        h = (h ^ N[i]) * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 29;
+    }
+    return h;
+}
+
+/* ===========================================================
+ *  Création / destruction (hors verrou)
+ * =========================================================== */
+
+static BBContexteModule *creerContexte(const uint64_t *N, int n, uint64_t h) {
+    BBContexteModule *C = (BBContexteModule*)calloc(1, sizeof(BBContexteModule));
+    C->hache = h;
+    C->N = (uint64_t*)malloc((size_t)n * sizeof(uint64_t));
+    memcpy(C->N, N, (size_t)n * sizeof(uint64_t));
+
+    // Les tableaux des noyaux doivent venir du tas, pas de l'arène de l'appelant
+    BigBinaryArena *prec = BigBinaryArena_activer(NULL);
+    bb_moduloPreparer(&C->red, N, n);
+    if (N[0] & 1u) bb_montPreparer(&C->mont, N, n);
+    BigBinaryArena_activer(prec);
+
+    C->references = 1;
+    return C;
+}
+
+static void detruireContexte(BBContexteModule *C) {
+    bb_moduloLiberer(&C->red);
+    if (C->mont.n != 0) bb_montLiberer(&C->mont);
+    free(C->N);
+    free(C);
+}
+
+/* ===========================================================
+ *  Table et liste LRU (verrou tenu)
+ * =========================================================== */
+
+static int memeModule(const BBContexteModule *C, uint64_t h, const uint64_t *N, int n) {
+    if (C->hache != h || C->red.nv != n) return 0;
+    // red.vn est décalé : la copie exacte de N est gardée à part
+    return memcmp(C->N, N, (size_t)n * sizeof(uint64_t)) == 0;
+}
+
+static void lruRetirer(BBContexteModule *C) {
+    if (C->lruPrec) C->lruPrec->lruSuiv = C->lruSuiv;
+    else lruTete = C->lruSuiv;
+    if (C->lruSuiv) C->lruSuiv->lruPrec = C->lruPrec;
+    else lruQueue = C->lruPrec;
+    C->lruPrec = C->lruSuiv = NULL;
+}
+
+static void lruEnTete(BBContexteModule *C) {
+    C->lruPrec = NULL;
+    C->lruSuiv = lruTete;
+    if (lruTete) lruTete->lruPrec = C;
+    lruTete = C;
+    if (lruQueue == NULL) lruQueue = C;
+}
+
+/* Sort C de la table ; libéré tout de suite s'il n'est plus utilisé */
+static void evincer(BBContexteModule *C) {
+    BBContexteModule **p = &seaux[C->hache % NB_SEAUX];
+    while (*p != C) p = &(*p)->seauSuivant;
+    *p = C->seauSuivant;
+    lruRetirer(C);
+    nbContextes--;
+
+    if (--C->references == 0) detruireContexte(C);   // la référence du cache
+}
+
+static BBContexteModule *chercher(uint64_t h, const uint64_t *N, int n) {
+    for (BBContexteModule *C = seaux[h % NB_SEAUX]; C != NULL; C = C->seauSuivant) {
+        if (memeModule(C, h, N, n)) return C;
+    }
+    return NULL;
+}
+
+/* ===========================================================
+ *  API interne
+ * =========================================================== */
+
+const BBContexteModule *bb_moduleObtenir(const uint64_t *N, int n) {
+    uint64_t h = hacher(N, n);
+
+    // CAS 1 : déjà en cache → passe en tête de la liste LRU
+    pthread_mutex_lock(&verrouCache);
+    BBContexteModule *C = chercher(h, N, n);
+    if (C != NULL) {
+        C->references++;
+        lruRetirer(C);
+        lruEnTete(C);
+        nbSucces++;
+        pthread_mutex_unlock(&verrouCache);
+        return C;
+    }
+    nbEchecs++;
+    int place = capacite > 0;
+    pthread_mutex_unlock(&verrouCache);
+
+    // CAS 2 : préparation hors verrou (division longue pour R² mod N)
+    C = creerContexte(N, n, h);
+    if (!place) return C;   // cache désactivé : contexte à usage unique
+
+    // ÉTAPE 3 : publication (un autre thread a pu nous devancer)
+    pthread_mutex_lock(&verrouCache);
+    BBContexteModule *existant = chercher(h, N, n);
+    if (existant != NULL) {
+        existant->references++;
+        pthread_mutex_unlock(&verrouCache);
+        detruireContexte(C);
+        return existant;
+    }
+    C->references++;   // référence du cache
+    C->seauSuivant = seaux[h % NB_SEAUX];
+    seaux[h % NB_SEAUX] = C;
+    lruEnTete(C);
+    nbContextes++;
+    while (nbContextes > capacite && lruQueue != NULL) evincer(lruQueue);
+    pthread_mutex_unlock(&verrouCache);
+    return C;
+}
+
+void bb_moduleRendre(const BBContexteModule *contexte) {
+    BBContexteModule *C = (BBContexteModule*)contexte;
+    pthread_mutex_lock(&verrouCache);
+    int dernier = (--C->references == 0);
+    pthread_mutex_unlock(&verrouCache);
+    if (dernier) detruireContexte(C);
+}
+
+/* ===========================================================
+ *  API publique
+ * =========================================================== */
+
+void BigBinary_cacheCapacite(int nb) {
+    pthread_mutex_lock(&verrouCache);
+    capacite = nb < 0 ? 0 : nb;
+    while (nbContextes > capacite && lruQueue != NULL) evincer(lruQueue);
+    pthread_mutex_unlock(&verrouCache);
+}
+
+void BigBinary_cacheVider(void) {
+    pthread_mutex_lock(&verrouCache);
+    while (lruQueue != NULL) evincer(lruQueue);
+    nbSucces = nbEchecs = 0;
+    pthread_mutex_unlock(&verrouCache);
+}
+
+void BigBinary_cacheStats(unsigned long long *succes, unsigned long long *echecs) {
+    pthread_mutex_lock(&verrouCache);
+    if (succes) *succes = nbSucces;
+    if (echecs) *echecs = nbEchecs;
+    pthread_mutex_unlock(&verrouCache);
+}
@@ -0,0 +1,287 @@
+/*
+ * ============================================================================
+ * BIGBINARY_CLIENT : CLIENT DE TEST DU SERVEUR (bigbinary_rpc.h)
+ * ============================================================================
+ *
+ * Envoie des requêtes à bigbinary_serveur et affiche les résultats, une
+ * ligne par commande, dans l'ordre des commandes :
+ *
+ *   expmod M E N     M^E mod N
+ *   rsa-enc CLE M    chiffrement avec la clé CLE du serveur (id décimal)
+ *   rsa-dec CLE C    déchiffrement
+ *   gcd A B          pgcd(A, B)
+ *
+ * Une commande sur la ligne de commande, ou, sans commande, une par
+ * ligne sur stdin. Les requêtes partent sans attendre chaque réponse : le
+ * serveur peut ainsi regrouper celles d'une même clé. Les réponses sont
+ * lues pendant l'envoi, car le serveur cesse de lire un client dont les
+ * réponses s'accumulent. Plusieurs clients lancés en parallèle
+ * reproduisent une charge concurrente.
+ *
+ * UTILISATION :
+ *   bigbinary_client -s chemin [--hex] [commande opérandes…]
+ *
+ * Code de sortie : 0 si toutes les requêtes ont réussi, 1 sinon. Le débit
+ * est affiché sur stderr.
+ * ============================================================================
+ */
+
+#include "bigbinary.h"
+#include "bigbinary_rpc.h"
+#include "commandes_lot.h"
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct {
+    unsigned char *d;
+    size_t lg, cap;
+} Octets;
+
+/* Résultat d'une commande, rangé à l'indice id - 1 */
+typedef struct {
+    char *texte;     // résultat, ou message d'erreur
+    int erreur;
+} Resultat;
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "Usage : %s -s chemin [--hex] [commande operandes...]\n"
+            "  expmod M E N | rsa-enc CLE M | rsa-dec CLE C | gcd A B\n"
+            "  sans commande : une commande par ligne sur stdin\n", prog);
+}
+
+static double maintenant(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void ajouter(Octets *t, const void *s, size_t n) {
+    if (t->lg + n > t->cap) {
+        size_t cap = t->cap ? t->cap : 4096;
+        while (cap < t->lg + n) cap *= 2;
+        t->d = (unsigned char*)realloc(t->d, cap);
+        t->cap = cap;
+    }
+    memcpy(t->d + t->lg, s, n);
+    t->lg += n;
+}
+
+static void ajouterU32(Octets *t, uint32_t v) {
+    unsigned char b[4];
+    rpc_ecrireU32(b, v);
+    ajouter(t, b, 4);
+}
+
+/**
+ * encoder - Ajoute la requête d'une commande (jetons déjà découpés)
+ *
+ * @return : NULL si la requête est ajoutée, sinon le message d'erreur
+ */
+static const char *encoder(Octets *t, uint32_t id, char **jetons, int n) {
+    static const struct { const char *nom; int op, nb, cle; } OPS[] = {
+        { "expmod", RPC_EXPMOD, 3, 0 }, { "rsa-enc", RPC_RSA_ENC, 1, 1 },
+        { "rsa-dec", RPC_RSA_DEC, 1, 1 }, { "gcd", RPC_GCD, 2, 0 },
+    };
+    int k = 0;
+    while (k < 4 && strcmp(OPS[k].nom, jetons[0]) != 0) k++;
+    if (k == 4) return "operation inconnue";
+    if (n != 1 + OPS[k].cle + OPS[k].nb) return "nombre d'operandes";
+
+    uint32_t cle = 0;
+    if (OPS[k].cle) {
+        char *fin;
+        cle = (uint32_t)strtoul(jetons[1], &fin, 10);
+        if (*fin != '\0') return "cle invalide";
+    }
+
+    // Corps : id, opération, clé, opérandes (octets gros-boutistes)
+    Octets corps = { NULL, 0, 0 };
+    ajouterU32(&corps, id);
+    unsigned char op = (unsigned char)OPS[k].op, nb = (unsigned char)OPS[k].nb;
+    ajouter(&corps, &op, 1);
+    ajouterU32(&corps, cle);
+    ajouter(&corps, &nb, 1);
+    for (int i = 0; i < OPS[k].nb; ++i) {
+        BigBinary X;
+        if (!lireOperande(jetons[1 + OPS[k].cle + i], &X)) {
+            free(corps.d);
+            return "operande invalide";
+        }
+        size_t lg = ((size_t)BigBinary_nbBits(X) + 7) / 8;
+        ajouterU32(&corps, (uint32_t)lg);
+        unsigned char *o = (unsigned char*)malloc(lg ? lg : 1);
+        BigBinary_toBytes(X, o, lg);
+        ajouter(&corps, o, lg);
+        free(o);
+        libereBigBinary(&X);
+    }
+
+    ajouterU32(t, (uint32_t)corps.lg);
+    ajouter(t, corps.d, corps.lg);
+    free(corps.d);
+    return NULL;
+}
+
+/* Range une réponse complète (sans son préfixe de longueur) */
+static void noterReponse(const unsigned char *m, uint32_t lg, Resultat *res, int nb, int hex) {
+    uint32_t id = rpc_lireU32(m);
+    int statut = m[4];
+    uint32_t l = rpc_lireU32(m + 5);
+    if (id >= 1 && id <= (uint32_t)nb && res[id - 1].texte == NULL && 9 + (size_t)l == lg) {
+        Resultat *r = &res[id - 1];
+        r->erreur = (statut != RPC_OK);
+        if (statut == RPC_OK) {
+            BigBinary X = initBigBinaryFromBytes(m + 9, l);
+            r->texte = texteOperande(X, hex);
+            libereBigBinary(&X);
+        } else {
+            r->texte = strdup(statut == RPC_ERR_CLE ? "cle inconnue"
+                              : statut == RPC_ERR_DOMAINE ? "hors domaine"
+                              : "requete invalide");
+        }
+    }
+}
+
+/**
+ * decouperReponses - Traite les réponses complètes reçues
+ *
+ * @return : nombre de réponses traitées (la fin incomplète reste dans
+ *   recu), -1 si le flux est invalide
+ */
+static int decouperReponses(Octets *recu, Resultat *res, int nb, int hex) {
+    size_t pos = 0;
+    int k = 0;
+    while (recu->lg - pos >= 4) {
+        uint32_t lg = rpc_lireU32(recu->d + pos);
+        if (lg < 9) return -1;
+        if (recu->lg - pos - 4 < lg) break;
+        noterReponse(recu->d + pos + 4, lg, res, nb, hex);
+        pos += 4 + (size_t)lg;
+        k++;
+    }
+    memmove(recu->d, recu->d + pos, recu->lg - pos);
+    recu->lg -= pos;
+    return k;
+}
+
+int main(int argc, char **argv) {
+    const char *chemin = NULL;
+    int hex = 0, premier = argc;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) chemin = argv[++i];
+        else if (strcmp(argv[i], "--hex") == 0) hex = 1;
+        else {
+            premier = i;
+            break;
+        }
+    }
+    if (chemin == NULL) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // ÉTAPE 1 : Toutes les requêtes, encodées à la suite
+    Octets envoi = { NULL, 0, 0 };
+    Resultat *res = NULL;
+    int nb = 0, nbEnvoyees = 0;
+    char *ligne = NULL;
+    size_t cap = 0;
+    for (;;) {
+        char *jetons[8];
+        int n = 0;
+        if (premier < argc) {
+            if (nb > 0) break;   // une seule commande en argument
+            for (int i = premier; i < argc && n < 8; ++i) jetons[n++] = argv[i];
+        } else {
+            if (getline(&ligne, &cap, stdin) < 0) break;
+            char *suite = NULL;
+            for (char *j = strtok_r(ligne, " \t\r\n", &suite); j != NULL && n < 8;
+                 j = strtok_r(NULL, " \t\r\n", &suite))
+                jetons[n++] = j;
+            if (n == 0 || jetons[0][0] == '#') continue;
+        }
+
+        res = (Resultat*)realloc(res, (size_t)(nb + 1) * sizeof(Resultat));
+        const char *msg = encoder(&envoi, (uint32_t)(nb + 1), jetons, n);
+        res[nb].erreur = (msg != NULL);
+        res[nb].texte = msg ? strdup(msg) : NULL;
+        if (msg == NULL) nbEnvoyees++;
+        nb++;
+    }
+    free(ligne);
+
+    // ÉTAPE 2 : Connexion, envoi d'un bloc, puis lecture des réponses
+    struct sockaddr_un adr;
+    memset(&adr, 0, sizeof(adr));
+    adr.sun_family = AF_UNIX;
+    strncpy(adr.sun_path, chemin, sizeof(adr.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr*)&adr, sizeof(adr)) < 0) {
+        fprintf(stderr, "Erreur: connexion impossible a %s\n", chemin);
+        return 1;
+    }
+
+    double t0 = maintenant();
+    int ok = 1, recues = 0;
+    size_t envoye = 0;
+    Octets recu = { NULL, 0, 0 };
+    if (envoi.lg == 0) shutdown(fd, SHUT_WR);
+    while (ok && recues < nbEnvoyees) {
+        struct pollfd pfd = { fd, (short)(POLLIN | (envoye < envoi.lg ? POLLOUT : 0)), 0 };
+        if (poll(&pfd, 1, -1) < 0) {
+            if (errno == EINTR) continue;
+            ok = 0;
+            break;
+        }
+
+        // Envoi : ce que la socket accepte, sans bloquer
+        if ((pfd.revents & POLLOUT) && envoye < envoi.lg) {
+            ssize_t w = send(fd, envoi.d + envoye, envoi.lg - envoye, MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (w > 0) envoye += (size_t)w;
+            else if (w < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) ok = 0;
+            if (envoye == envoi.lg) shutdown(fd, SHUT_WR);   // le serveur lit la fin de flux, finit et répond
+        }
+
+        // Réception : les réponses arrivent pendant l'envoi
+        if (ok && (pfd.revents & (POLLIN | POLLHUP | POLLERR))) {
+            unsigned char tampon[65536];
+            ssize_t r = recv(fd, tampon, sizeof(tampon), MSG_DONTWAIT);
+            if (r > 0) {
+                ajouter(&recu, tampon, (size_t)r);
+                int k = decouperReponses(&recu, res, nb, hex);
+                if (k < 0) ok = 0;
+                else recues += k;
+            } else if (r == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                ok = 0;
+            }
+        }
+    }
+    free(recu.d);
+    double duree = maintenant() - t0;
+    close(fd);
+    if (!ok) fprintf(stderr, "Erreur: connexion interrompue par le serveur\n");
+
+    // ÉTAPE 3 : Résultats dans l'ordre des commandes
+    int echecs = !ok;
+    for (int i = 0; i < nb; ++i) {
+        if (res[i].texte == NULL) printf("erreur ligne %d : pas de reponse\n", i + 1);
+        else if (res[i].erreur) printf("erreur ligne %d : %s\n", i + 1, res[i].texte);
+        else printf("%s\n", res[i].texte);
+        echecs += (res[i].texte == NULL || res[i].erreur);
+        free(res[i].texte);
+    }
+    fprintf(stderr, "%d requete(s), %.3f s, %.0f requetes/s\n", nbEnvoyees, duree,
+            duree > 0 ? nbEnvoyees / duree : 0.0);
+
+    free(res);
+    free(envoi.d);
+    return echecs ? 1 : 0;
+}
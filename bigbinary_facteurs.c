@@ -0,0 +1,560 @@
+#include "bigbinary_interne.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * ============================================================================
+ * FACTORISATION : AUDIT DES MODULES RSA FAIBLES
+ * ============================================================================
+ *
+ * Un module saisi à la main (voir la phase 3 de main.c) a souvent des
+ * facteurs p et q mal choisis. Trois méthodes, chacune rapide sur un
+ * défaut précis :
+ *
+ *   Fermat     p et q proches : N = a² - b², a part de ⌈√N⌉
+ *   p − 1      p − 1 friable (tous ses facteurs premiers ≤ B1)
+ *   rho        petit facteur p : cycle de x ↦ x² + c mod p en ~√p pas
+ *              (variante de Brent, pgcd groupés)
+ *
+ * Chaque méthode a un budget d'itérations et de temps : sur une clé
+ * correcte, elles échouent toutes, le budget borne donc le coût de l'audit.
+ * BigBinary_auditerModules() répartit une liste de modules sur des threads.
+ *
+ * Les boucles chaudes (rho, p − 1) travaillent en représentation de
+ * Montgomery avec les constantes du cache des modules : aucune division.
+ * ============================================================================
+ */
+
+#define FERMAT_DEFAUT   100000LL
+#define RHO_DEFAUT      (1LL << 18)
+#define PM1_DEFAUT      100000LL
+#define PM1_B1_MAX      10000000LL  // B1 maximal : le crible occupe B1 + 1 octets
+#define RHO_LOT         100         // pas de rho entre deux pgcd
+#define PM1_LOT         8           // expMod de p − 1 entre deux pgcd
+
+static double maintenant(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Budget effectif : itérations (défaut de la méthode si 0) et échéance */
+typedef struct {
+    long long iterations;
+    double echeance;        // 0 : pas de limite de temps
+} Limite;
+
+static Limite limiter(const BigBinaryBudget *budget, long long defaut) {
+    Limite L = { defaut, 0.0 };
+    if (budget != NULL) {
+        if (budget->iterations > 0) L.iterations = budget->iterations;
+        if (budget->secondes > 0) L.echeance = maintenant() + budget->secondes;
+    }
+    return L;
+}
+
+static int tempsEcoule(const Limite *L) {
+    return L->echeance > 0 && maintenant() > L->echeance;
+}
+
+/* BigBinary depuis n mots */
+static BigBinary depuisMots(const uint64_t *m, int n) {
+    BigBinary R = bb_creer(n);
+    memcpy(bb_mots(&R), m, (size_t)n * sizeof(uint64_t));
+    normalizeBigBinary(&R);
+    return R;
+}
+
+/* 1 < G < N : facteur non trivial */
+static int nonTrivial(const BigBinary G, const BigBinary N) {
+    return BigBinary_nbBits(G) > 1 && BigBinary_cmp(G, N) < 0;
+}
+
+/* ===========================================================
+ *  Fermat
+ * =========================================================== */
+
+/*
+ * Un carré parfait est un résidu quadratique modulo 64, 63, 65 et 11 :
+ * ces tests éliminent ~99,5 % des candidats avant la racine carrée.
+ * b² - N est suivi modulo 64 (mot de poids faible) et modulo
+ * 63 × 65 × 11 = 45045 (mis à jour avec l'incrément).
+ */
+#define MOD_FILTRE 45045u
+
+static int estResidu(unsigned r, unsigned m) {
+    for (unsigned x = 0; x < m; ++x)
+        if ((x * x) % m == r) return 1;
+    return 0;
+}
+
+static unsigned char residus64[64], residus63[63], residus65[65], residus11[11];
+static pthread_once_t residusUneFois = PTHREAD_ONCE_INIT;
+
+static void preparerResidus(void) {
+    for (unsigned r = 0; r < 64; ++r) residus64[r] = (unsigned char)estResidu(r, 64);
+    for (unsigned r = 0; r < 63; ++r) residus63[r] = (unsigned char)estResidu(r, 63);
+    for (unsigned r = 0; r < 65; ++r) residus65[r] = (unsigned char)estResidu(r, 65);
+    for (unsigned r = 0; r < 11; ++r) residus11[r] = (unsigned char)estResidu(r, 11);
+}
+
+/*
+ * Reste de A modulo un petit entier, par demi-mots : r < m < 2^32, donc
+ * r·2^32 + demi-mot tient sur 64 bits (pas besoin d'entiers de 128 bits)
+ */
+static unsigned resteMot(const BigBinary A, unsigned m) {
+    const uint64_t *a = bb_motsC(&A);
+    uint64_t r = 0;
+    for (int i = bb_motsUtiles(&A) - 1; i >= 0; --i) {
+        r = ((r << 32) | (a[i] >> 32)) % m;
+        r = ((r << 32) | (a[i] & 0xFFFFFFFFu)) % m;
+    }
+    return (unsigned)r;
+}
+
+/* A += B en place (stockage de A agrandi si besoin) */
+static void ajouter(BigBinary *A, const BigBinary B) {
+    int na = A->Taille, nb = bb_motsUtiles(&B);
+    int n = ((na > nb) ? na : nb) + 1;
+    bb_reserver(A, n);
+    uint64_t *a = bb_mots(A);
+    const uint64_t *b = bb_motsC(&B);
+    memset(a + na, 0, (size_t)(n - na) * sizeof(uint64_t));
+    uint64_t retenue = 0;
+    for (int i = 0; i < n; ++i) {
+        uint64_t bmot = (i < nb) ? b[i] : 0;
+        uint64_t s = a[i] + retenue;
+        retenue = (s < retenue);
+        s += bmot;
+        retenue += (s < bmot);
+        a[i] = s;
+    }
+    A->Taille = n;
+    A->Normalise = 0;
+    normalizeBigBinary(A);
+}
+
+/**
+ * BigBinary_fermat - N = a² - b² = (a - b)(a + b)
+ *
+ * ALGORITHME :
+ *   a = ⌈√N⌉, r = a² - N, d = 2a + 1 ; tant que r n'est pas un carré :
+ *   r += d, d += 2 (donc r = a² - N pour a = (d - 1) / 2, sans produit)
+ *   Quand r = b² : facteur a - b. Le nombre de tours est ≈ (q - p)² / 8√N :
+ *   immédiat si p et q partagent leurs bits de tête.
+ *
+ * @param N : Le module (impair)
+ * @param budget : Itérations (défaut 100000) et temps ; NULL → défauts
+ * @param facteur : Reçoit un facteur non trivial
+ * @return : 1 si un facteur a été trouvé, 0 sinon
+ */
+int BigBinary_fermat(const BigBinary N, const BigBinaryBudget *budget, BigBinary *facteur) {
+    if (BigBinary_nbBits(N) < 3 || estPair(N)) return 0;
+    pthread_once(&residusUneFois, preparerResidus);
+    Limite L = limiter(budget, FERMAT_DEFAUT);
+    BBPortee portee = bb_porteeOuvrir();
+
+    // ÉTAPE 1 : a = ⌈√N⌉, r = a² - N, d = 2a + 1
+    BigBinary un = bb_depuisMot(1), deux = bb_depuisMot(2);
+    BigBinary a = BigBinary_isqrt(N);
+    BigBinary a2 = bb_produit(a, a);
+    if (BigBinary_cmp(a2, N) < 0) {
+        ajouter(&a, un);
+        libereBigBinary(&a2);
+        a2 = bb_produit(a, a);
+    }
+    BigBinary r = initBigBinary();
+    BigBinary_subAbs(&r, a2, N);
+    BigBinary d = decaleGauche(a, 1);
+    ajouter(&d, un);
+    libereBigBinary(&a2);
+    libereBigBinary(&a);
+    unsigned rf = resteMot(r, MOD_FILTRE), df = resteMot(d, MOD_FILTRE);
+
+    // ÉTAPE 2 : avancer jusqu'à ce que r soit un carré
+    BigBinary p = initBigBinary();
+    int fini = 0;
+    for (long long it = 0; it < L.iterations && !fini; ++it) {
+        if ((it & 1023) == 1023 && tempsEcoule(&L)) break;
+
+        // Filtre : r doit être un résidu quadratique modulo 64, 63, 65 et 11
+        uint64_t bas = bb_motsC(&r)[0];
+        if (residus64[bas & 63] && residus63[rf % 63] && residus65[rf % 65] && residus11[rf % 11]) {
+            BigBinary b = BigBinary_isqrt(r);
+            BigBinary b2 = bb_produit(b, b);
+            if (BigBinary_cmp(b2, r) == 0) {
+                // a - b = (d - 1) / 2 - b ; a - b = 1 : N est premier
+                BigBinary a = decaleDroite(d, 1);
+                libereBigBinary(&p);
+                p = soustractionBigBinary(a, b);
+                libereBigBinary(&a);
+                fini = 1;
+            }
+            libereBigBinary(&b);
+            libereBigBinary(&b2);
+        }
+
+        ajouter(&r, d);
+        ajouter(&d, deux);
+        rf = (rf + df) % MOD_FILTRE;
+        df = (df + 2) % MOD_FILTRE;
+    }
+
+    int trouve = fini && nonTrivial(p, N);
+    libereBigBinary(&r); libereBigBinary(&d);
+    libereBigBinary(&un); libereBigBinary(&deux);
+    p = bb_porteeFermer(portee, p);
+    if (trouve) *facteur = p;
+    else libereBigBinary(&p);
+    return trouve;
+}
+
+/* ===========================================================
+ *  Pollard rho (Brent)
+ * =========================================================== */
+
+/* r = a + b mod N sur n mots (a, b < N) */
+static void ajouterMod(uint64_t *r, const uint64_t *a, const uint64_t *b, const uint64_t *N, int n) {
+    uint64_t retenue = 0;
+    for (int i = 0; i < n; ++i) {
+        uint64_t s = a[i] + retenue;
+        retenue = (s < retenue);
+        s += b[i];
+        retenue += (s < b[i]);
+        r[i] = s;
+    }
+    int superieur = (retenue != 0);
+    if (!superieur) {
+        superieur = 1;   // égal à N : aussi à réduire
+        for (int i = n - 1; i >= 0; --i) {
+            if (r[i] != N[i]) { superieur = (r[i] > N[i]); break; }
+        }
+    }
+    if (!superieur) return;
+    uint64_t emprunt = 0;
+    for (int i = 0; i < n; ++i) {
+        uint64_t d = r[i] - N[i];
+        uint64_t e = (r[i] < N[i]);
+        r[i] = d - emprunt;
+        emprunt = e | (d < emprunt);
+    }
+}
+
+/* r = |a - b| sur n mots */
+static void ecartMots(uint64_t *r, const uint64_t *a, const uint64_t *b, int n) {
+    int i = n - 1;
+    while (i >= 0 && a[i] == b[i]) i--;
+    if (i >= 0 && a[i] < b[i]) {
+        const uint64_t *t = a;
+        a = b;
+        b = t;
+    }
+    uint64_t emprunt = 0;
+    for (int j = 0; j < n; ++j) {
+        uint64_t d = a[j] - b[j];
+        uint64_t e = (a[j] < b[j]);
+        r[j] = d - emprunt;
+        emprunt = e | (d < emprunt);
+    }
+}
+
+/* pgcd(mots, N) */
+static BigBinary pgcdMots(const uint64_t *m, int n, const BigBinary N) {
+    BigBinary M = depuisMots(m, n);
+    BigBinary G = pgcdBinaire(M, N);
+    libereBigBinary(&M);
+    return G;
+}
+
+/**
+ * BigBinary_pollardRho - Facteur par la méthode rho de Pollard (variante de Brent)
+ *
+ * PRINCIPE : x ↦ x² + c finit par boucler modulo le plus petit facteur p,
+ *   au bout de ~√p pas ; pgcd(x - y, N) révèle alors p.
+ *
+ * VARIANTE DE BRENT : y avance par puissances de 2 (r = 1, 2, 4, ...)
+ *   depuis un point fixe x, et les écarts |x - y| sont multipliés entre
+ *   eux modulo N : un seul pgcdBinaire tous les 100 pas au lieu d'un par
+ *   pas. Si le produit devient nul modulo N (pgcd = N), on reprend le
+ *   dernier lot pas à pas ; si le pgcd reste N, autre constante c.
+ *
+ * Tout est en représentation de Montgomery sans conversion : x ↦ x²R⁻¹ + c
+ *   est encore un polynôme du second degré (pour z = xR⁻¹), et R est
+ *   premier avec N, donc pgcd(qR, N) = pgcd(q, N).
+ *
+ * @param N : Le module (impair)
+ * @param budget : Pas de la suite (défaut 2^18) et temps ; NULL → défauts
+ * @param facteur : Reçoit un facteur non trivial
+ * @return : 1 si un facteur a été trouvé, 0 sinon
+ */
+int BigBinary_pollardRho(const BigBinary N, const BigBinaryBudget *budget, BigBinary *facteur) {
+    if (BigBinary_nbBits(N) < 3 || estPair(N)) return 0;
+    Limite L = limiter(budget, RHO_DEFAUT);
+    int n = bb_motsUtiles(&N);
+    size_t octets = (size_t)n * sizeof(uint64_t);
+
+    BBPortee portee = bb_porteeOuvrir();
+    const BBContexteModule *ctx = bb_moduleObtenir(bb_motsC(&N), n);
+    const BBMontgomery *mont = &ctx->mont;
+    const uint64_t *Nm = mont->N;
+
+    uint64_t *x = (uint64_t*)bb_allouerZero(octets);
+    uint64_t *y = (uint64_t*)bb_allouerZero(octets);
+    uint64_t *ys = (uint64_t*)bb_allouerZero(octets);
+    uint64_t *q = (uint64_t*)bb_allouerZero(octets);
+    uint64_t *c = (uint64_t*)bb_allouerZero(octets);
+    uint64_t *ecart = (uint64_t*)bb_allouer(octets);
+    uint64_t *t = (uint64_t*)bb_allouer((size_t)(n + 2) * sizeof(uint64_t));
+
+    BigBinary G = initBigBinary();
+    int trouve = 0;
+    long long pas = 0;
+
+    for (uint64_t constante = 1; !trouve && pas < L.iterations; ++constante) {
+        // Nouvelle suite : y0 = 2, c = constante, q = 1
+        memset(y, 0, octets);
+        memset(c, 0, octets);
+        memset(q, 0, octets);
+        y[0] = 2;
+        c[0] = constante;
+        q[0] = 1;
+        libereBigBinary(&G);
+        G = bb_depuisMot(1);
+
+        for (long long r = 1; BigBinary_nbBits(G) == 1 && pas < L.iterations; r *= 2) {
+            // x = y, puis y avance de r pas sans rien comparer
+            memcpy(x, y, octets);
+            for (long long i = 0; i < r; ++i) {
+                bb_montMul(mont, y, y, y, t);
+                ajouterMod(y, y, c, Nm, n);
+            }
+            pas += r;
+
+            // Lots de RHO_LOT pas : produit des écarts, puis un pgcd
+            for (long long k = 0; k < r && BigBinary_nbBits(G) == 1; k += RHO_LOT) {
+                memcpy(ys, y, octets);
+                long long m = (r - k < RHO_LOT) ? r - k : RHO_LOT;
+                for (long long i = 0; i < m; ++i) {
+                    bb_montMul(mont, y, y, y, t);
+                    ajouterMod(y, y, c, Nm, n);
+                    ecartMots(ecart, x, y, n);
+                    bb_montMul(mont, q, q, ecart, t);
+                }
+                pas += m;
+                libereBigBinary(&G);
+                G = pgcdMots(q, n, N);
+                if (tempsEcoule(&L)) pas = L.iterations;
+            }
+        }
+
+        // pgcd = N : le lot a sauté le facteur, on le reprend pas à pas
+        if (BigBinary_cmp(G, N) == 0) {
+            do {
+                bb_montMul(mont, ys, ys, ys, t);
+                ajouterMod(ys, ys, c, Nm, n);
+                ecartMots(ecart, x, ys, n);
+                libereBigBinary(&G);
+                G = pgcdMots(ecart, n, N);
+            } while (BigBinary_nbBits(G) == 1);
+        }
+        trouve = nonTrivial(G, N);
+    }
+
+    bb_liberer(t); bb_liberer(ecart); bb_liberer(c);
+    bb_liberer(q); bb_liberer(ys); bb_liberer(y); bb_liberer(x);
+    bb_moduleRendre(ctx);
+    G = bb_porteeFermer(portee, G);
+    if (trouve) *facteur = G;
+    else libereBigBinary(&G);
+    return trouve;
+}
+
+/* ===========================================================
+ *  Pollard p − 1
+ * =========================================================== */
+
+/* Crible d'Ératosthène : premiers[i] = 1 si i est premier (i ≤ borne) ; NULL si mémoire épuisée */
+static unsigned char *crible(long long borne) {
+    unsigned char *premiers = (unsigned char*)malloc((size_t)borne + 1);
+    if (premiers == NULL) return NULL;
+    memset(premiers, 1, (size_t)borne + 1);
+    premiers[0] = 0;
+    if (borne >= 1) premiers[1] = 0;
+    for (long long i = 2; i * i <= borne; ++i)
+        if (premiers[i])
+            for (long long j = i * i; j <= borne; j += i) premiers[j] = 0;
+    return premiers;
+}
+
+/* pgcd(a - 1, N) */
+static BigBinary pgcdMoinsUn(const BigBinary a, const BigBinary N, const BigBinary un) {
+    BigBinary am1 = initBigBinary();
+    BigBinary_subAbs(&am1, a, un);
+    BigBinary G = pgcdBinaire(am1, N);
+    libereBigBinary(&am1);
+    return G;
+}
+
+/**
+ * BigBinary_pollardPm1 - Facteur par la méthode p − 1 de Pollard
+ *
+ * PRINCIPE : si p − 1 divise E = ∏ (premiers ≤ B1, à la plus grande
+ *   puissance ≤ B1), alors 2^E ≡ 1 mod p (Fermat) et pgcd(2^E - 1, N) = p.
+ *
+ * Les puissances de premiers sont groupées par produits de 64 bits : un
+ *   BigBinary_expMod (Montgomery, module en cache) par groupe, et un pgcd
+ *   tous les 8 groupes. Si le pgcd vaut N (p − 1 et q − 1 tous deux
+ *   friables), les derniers groupes sont refaits premier par premier.
+ *
+ * @param N : Le module (impair)
+ * @param budget : Borne B1 (défaut 100000, plafonnée à PM1_B1_MAX = 10^7)
+ *   et temps ; NULL → défauts
+ * @param facteur : Reçoit un facteur non trivial
+ * @return : 1 si un facteur a été trouvé, 0 sinon
+ */
+int BigBinary_pollardPm1(const BigBinary N, const BigBinaryBudget *budget, BigBinary *facteur) {
+    if (BigBinary_nbBits(N) < 3 || estPair(N)) return 0;
+    Limite L = limiter(budget, PM1_DEFAUT);
+    // Le même budget sert aussi à rho, où 2^28 pas sont raisonnables : sans
+    // plafond, B1 fixerait la taille du crible avant tout contrôle du temps
+    long long B1 = L.iterations < 2 ? 2 : L.iterations;
+    if (B1 > PM1_B1_MAX) B1 = PM1_B1_MAX;
+    unsigned char *premiers = crible(B1);
+    if (premiers == NULL) return 0;
+
+    BBPortee portee = bb_porteeOuvrir();
+    BigBinary un = bb_depuisMot(1);
+    BigBinary a = bb_depuisMot(2), sauvegarde = bb_depuisMot(2);
+    BigBinary G = bb_depuisMot(1);
+    long long pSauvegarde = 2;   // premier de reprise si le pgcd vaut N
+    int groupes = 0;
+
+    long long p = 2;
+    while (p <= B1 && BigBinary_nbBits(G) == 1) {
+        // ÉTAPE 1 : produit de puissances de premiers tenant sur 64 bits
+        uint64_t e = 1;
+        for (; p <= B1; ++p) {
+            if (!premiers[p]) continue;
+            uint64_t pe = (uint64_t)p;
+            while (pe <= (uint64_t)B1 / (uint64_t)p) pe *= (uint64_t)p;
+            if (e > UINT64_MAX / pe) break;
+            e *= pe;
+        }
+        BigBinary E = bb_depuisMot(e);
+        BigBinary s = BigBinary_expMod(a, E, N);
+        libereBigBinary(&E);
+        libereBigBinary(&a);
+        a = s;
+
+        // ÉTAPE 2 : pgcd tous les PM1_LOT groupes, et à la fin
+        if (++groupes % PM1_LOT == 0 || p > B1) {
+            libereBigBinary(&G);
+            G = pgcdMoinsUn(a, N, un);
+            if (BigBinary_nbBits(G) == 1) {
+                libereBigBinary(&sauvegarde);
+                sauvegarde = copieBigBinary(a);
+                pSauvegarde = p;
+            }
+            if (tempsEcoule(&L)) break;
+        }
+    }
+
+    // ÉTAPE 3 : pgcd = N → reprise premier par premier depuis la sauvegarde
+    if (BigBinary_cmp(G, N) == 0) {
+        libereBigBinary(&a);
+        a = sauvegarde;
+        sauvegarde = initBigBinary();
+        libereBigBinary(&G);
+        G = bb_depuisMot(1);
+        for (long long r = pSauvegarde; r < p && BigBinary_nbBits(G) == 1; ++r) {
+            if (!premiers[r]) continue;
+            uint64_t pe = (uint64_t)r;
+            while (pe <= (uint64_t)B1 / (uint64_t)r) pe *= (uint64_t)r;
+            BigBinary E = bb_depuisMot(pe);
+            BigBinary s = BigBinary_expMod(a, E, N);
+            libereBigBinary(&E);
+            libereBigBinary(&a);
+            a = s;
+            libereBigBinary(&G);
+            G = pgcdMoinsUn(a, N, un);
+        }
+    }
+
+    free(premiers);
+    int trouve = nonTrivial(G, N);
+    libereBigBinary(&a); libereBigBinary(&sauvegarde); libereBigBinary(&un);
+    G = bb_porteeFermer(portee, G);
+    if (trouve) *facteur = G;
+    else libereBigBinary(&G);
+    return trouve;
+}
+
+/* ===========================================================
+ *  Audit de plusieurs modules en parallèle
+ * =========================================================== */
+
+typedef struct {
+    const BigBinary *modules;
+    BigBinaryAudit *resultats;
+    int nb;
+    const BigBinaryBudget *budget;
+    int suivant;                // prochain module à prendre
+    pthread_mutex_t verrou;
+} Audit;
+
+/* Méthodes de la moins chère à la plus chère, arrêt au premier facteur */
+static void auditerUn(const BigBinary N, const BigBinaryBudget *budget, BigBinaryAudit *res) {
+    double debut = maintenant();
+    res->methode = BB_FACT_AUCUNE;
+    res->facteur = initBigBinary();
+
+    if (estPair(N) && BigBinary_nbBits(N) > 2) {
+        res->methode = BB_FACT_TRIVIALE;
+        res->facteur = bb_depuisMot(2);
+    } else if (BigBinary_fermat(N, budget, &res->facteur)) {
+        res->methode = BB_FACT_FERMAT;
+    } else if (BigBinary_pollardPm1(N, budget, &res->facteur)) {
+        res->methode = BB_FACT_PM1;
+    } else if (BigBinary_pollardRho(N, budget, &res->facteur)) {
+        res->methode = BB_FACT_RHO;
+    }
+    res->secondes = maintenant() - debut;
+}
+
+static void *travailleurAudit(void *arg) {
+    Audit *A = (Audit*)arg;
+    for (;;) {
+        pthread_mutex_lock(&A->verrou);
+        int i = A->suivant++;
+        pthread_mutex_unlock(&A->verrou);
+        if (i >= A->nb) break;
+        auditerUn(A->modules[i], A->budget, &A->resultats[i]);
+    }
+    return NULL;
+}
+
+void BigBinary_auditerModules(const BigBinary *modules, BigBinaryAudit *resultats, int nb,
+                              const BigBinaryBudget *budget, int nbThreads) {
+    if (nb <= 0) return;
+    if (nbThreads <= 0) nbThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nbThreads < 1) nbThreads = 1;
+    if (nbThreads > nb) nbThreads = nb;
+
+    Audit A = { modules, resultats, nb, budget, 0, PTHREAD_MUTEX_INITIALIZER };
+
+    // Un seul thread : pas de création, le thread appelant fait tout
+    if (nbThreads == 1) {
+        travailleurAudit(&A);
+        return;
+    }
+
+    pthread_t *threads = (pthread_t*)malloc((size_t)nbThreads * sizeof(pthread_t));
+    for (int i = 0; i < nbThreads; ++i) pthread_create(&threads[i], NULL, travailleurAudit, &A);
+    for (int i = 0; i < nbThreads; ++i) pthread_join(threads[i], NULL);
+    free(threads);
+    pthread_mutex_destroy(&A.verrou);
+}
@@ -0,0 +1,156 @@
+#include "bigbinary_fixe.h"
+#include "bigbinary_interne.h"
+#include <string.h>
+
+/*
+ * ============================================================================
+ * BIGBINARY DE LARGEUR FIXE : CONVERSIONS ET MONTGOMERY
+ * ============================================================================
+ *
+ * Même algorithme que bb_montMul (CIOS, voir bigbinary_noyaux.c), mais le
+ * nombre de mots n = BITS / 64 est une constante : les boucles internes
+ * sont déroulées par le compilateur et le tampon de travail est sur la
+ * pile. Le module peut avoir moins de BITS bits significatifs : R reste
+ * 2^BITS, seule la condition N impair compte.
+ * ============================================================================
+ */
+
+/*
+ * Au-delà de cette largeur, le déroulement complet n'apporte plus rien
+ * (le code ne tient plus dans le cache d'instructions) : montMul passe par
+ * bb_montMul et ses noyaux BMI2/ADX, avec le tampon de travail sur la pile.
+ */
+#define BITS_NOYAU_GENERAL 1024
+
+/**
+ * BB_FIXE_DEFINIR(BITS) : Fonctions non en ligne de BigBinary<BITS>
+ */
+#define BB_FIXE_DEFINIR(BITS)                                                           \
+                                                                                        \
+int BigBinary##BITS##_depuisBigBinary(BigBinary##BITS *r, const BigBinary A) {          \
+    int n = bb_motsUtiles(&A);                                                          \
+    if (n > (BITS) / 64) return 0;                                                      \
+    memcpy(r->Mots, bb_motsC(&A), (size_t)n * sizeof(uint64_t));                        \
+    memset(r->Mots + n, 0, (size_t)((BITS) / 64 - n) * sizeof(uint64_t));               \
+    return 1;                                                                           \
+}                                                                                       \
+                                                                                        \
+BigBinary BigBinary##BITS##_versBigBinary(const BigBinary##BITS *a) {                   \
+    BigBinary R = bb_creer((BITS) / 64);                                                \
+    memcpy(bb_mots(&R), a->Mots, sizeof(a->Mots));                                      \
+    normalizeBigBinary(&R);                                                             \
+    return R;                                                                           \
+}                                                                                       \
+                                                                                        \
+/* ÉTAPE 1 : n0 par Newton ; ÉTAPE 2 : R² mod N par division de 2^(2·BITS) */          \
+int BigBinary##BITS##_montPreparer(BigBinary##BITS##Mont *M, const BigBinary##BITS *N) { \
+    enum { n = (BITS) / 64 };                                                           \
+    if ((N->Mots[0] & 1u) == 0) return 0;                                               \
+    M->N = *N;                                                                          \
+                                                                                        \
+    uint64_t x = N->Mots[0];                                                            \
+    for (int i = 0; i < 5; ++i) x *= 2 - N->Mots[0] * x;                                \
+    M->n0 = (uint64_t)0 - x;                                                            \
+                                                                                        \
+    int nu = n;                                                                         \
+    while (N->Mots[nu - 1] == 0) nu--;   /* N impair : nu ≥ 1 */                        \
+    uint64_t u[2 * n + 1];                                                              \
+    memset(u, 0, sizeof(u));                                                            \
+    u[2 * n] = 1;                                                                       \
+    memset(M->R2.Mots, 0, sizeof(M->R2.Mots));                                          \
+    bb_divMots(NULL, M->R2.Mots, u, 2 * n + 1, N->Mots, nu);                            \
+    return 1;                                                                           \
+}                                                                                       \
+                                                                                        \
+void BigBinary##BITS##_montMul(const BigBinary##BITS##Mont *M, BigBinary##BITS *r,      \
+                               const BigBinary##BITS *a, const BigBinary##BITS *b) {    \
+    enum { n = (BITS) / 64 };                                                           \
+    const uint64_t *A = a->Mots, *N = M->N.Mots;                                        \
+    uint64_t t[n + 2];                                                                  \
+                                                                                        \
+    if ((BITS) >= BITS_NOYAU_GENERAL) {                                                 \
+        BBMontgomery G = { (uint64_t *)N, (uint64_t *)M->R2.Mots, M->n0, n };           \
+        bb_montMul(&G, r->Mots, A, b->Mots, t);                                         \
+        return;                                                                         \
+    }                                                                                   \
+    memset(t, 0, sizeof(t));                                                            \
+                                                                                        \
+    for (int i = 0; i < n; ++i) {                                                       \
+        /* t += a × b[i] */                                                             \
+        uint64_t bi = b->Mots[i], c = 0, hi, lo;                                        \
+        BB_FIXE_DEROULER                                                                \
+        for (int j = 0; j < n; ++j) {                                                   \
+            lo = bb_mul64(A[j], bi, &hi);                                               \
+            lo += t[j];                                                                 \
+            hi += (lo < t[j]);                                                          \
+            lo += c;                                                                    \
+            hi += (lo < c);                                                             \
+            t[j] = lo;                                                                  \
+            c = hi;                                                                     \
+        }                                                                               \
+        uint64_t s = t[n] + c;                                                          \
+        t[n + 1] = (s < c);                                                             \
+        t[n] = s;                                                                       \
+                                                                                        \
+        /* t = (t + m × N) / 2^64 */                                                    \
+        uint64_t m = t[0] * M->n0;                                                      \
+        lo = bb_mul64(m, N[0], &hi);                                                    \
+        lo += t[0];                                                                     \
+        c = hi + (lo < t[0]);                                                           \
+        BB_FIXE_DEROULER                                                                \
+        for (int j = 1; j < n; ++j) {                                                   \
+            lo = bb_mul64(m, N[j], &hi);                                                \
+            lo += t[j];                                                                 \
+            hi += (lo < t[j]);                                                          \
+            lo += c;                                                                    \
+            hi += (lo < c);                                                             \
+            t[j - 1] = lo;                                                              \
+            c = hi;                                                                     \
+        }                                                                               \
+        s = t[n] + c;                                                                   \
+        t[n - 1] = s;                                                                   \
+        t[n] = t[n + 1] + (s < c);                                                      \
+    }                                                                                   \
+                                                                                        \
+    /* t < 2N : on garde t - N sauf s'il est négatif */                                 \
+    BigBinary##BITS d, *tt = (BigBinary##BITS *)t;                                      \
+    uint64_t emprunt = BigBinary##BITS##_sub(&d, tt, &M->N);                            \
+    if (t[n] != 0 || !emprunt) *r = d;                                                  \
+    else memcpy(r->Mots, t, sizeof(r->Mots));                                           \
+}                                                                                       \
+                                                                                        \
+/* Fenêtre fixe de gauche à droite, table des puissances sur la pile */                 \
+void BigBinary##BITS##_expMod(const BigBinary##BITS##Mont *M, BigBinary##BITS *r,       \
+                              const BigBinary##BITS *base, const BigBinary exp) {       \
+    BigBinary##BITS table[32], acc, un;                                                 \
+    memset(&un, 0, sizeof(un));                                                         \
+    un.Mots[0] = 1;                                                                     \
+                                                                                        \
+    int nbBitsExp = BigBinary_nbBits(exp);                                              \
+    int k = bb_tailleFenetre(nbBitsExp);                                                \
+    BigBinary##BITS##_montMul(M, &table[0], &un, &M->R2);        /* 1~ = R mod N */     \
+    BigBinary##BITS##_montMul(M, &table[1], base, &M->R2);       /* base~ */            \
+    for (int i = 2; i < (1 << k); ++i)                                                  \
+        BigBinary##BITS##_montMul(M, &table[i], &table[i - 1], &table[1]);              \
+                                                                                        \
+    if (nbBitsExp == 0) {                                                               \
+        acc = table[0];                                                                 \
+    } else {                                                                            \
+        int reste = nbBitsExp % k ? nbBitsExp % k : k;                                  \
+        int pos = nbBitsExp - reste;                                                    \
+        acc = table[bb_bitsExposant(&exp, pos, reste)];                                 \
+        while (pos > 0) {                                                               \
+            pos -= k;                                                                   \
+            for (int j = 0; j < k; ++j) BigBinary##BITS##_montMul(M, &acc, &acc, &acc); \
+            int v = bb_bitsExposant(&exp, pos, k);                                      \
+            if (v) BigBinary##BITS##_montMul(M, &acc, &acc, &table[v]);                 \
+        }                                                                               \
+    }                                                                                   \
+    BigBinary##BITS##_montMul(M, r, &acc, &un);                                         \
+}
+
+BB_FIXE_DEFINIR(256)
+BB_FIXE_DEFINIR(512)
+BB_FIXE_DEFINIR(1024)
+BB_FIXE_DEFINIR(2048)
+BB_FIXE_DEFINIR(4096)
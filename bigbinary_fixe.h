@@ -0,0 +1,123 @@
+#ifndef BIGBINARY_FIXE_H
+#define BIGBINARY_FIXE_H
+
+/*
+ * ============================================================================
+ * BIGBINARY DE LARGEUR FIXE : 256, 512, 1024, 2048, 4096 BITS
+ * ============================================================================
+ *
+ * BigBinary a une taille variable : chaque boucle lit Taille à l'exécution
+ * et ne peut pas être déroulée. Pour les tailles RSA courantes, les types
+ * ci-dessous ont un nombre de mots connu à la compilation :
+ *
+ *   BigBinary2048 x;        // 32 mots de 64 bits, sur la pile, poids faible en premier
+ *
+ * Les fonctions sont générées par macro pour chaque largeur (préfixe
+ * BigBinary<bits>_) :
+ *   - add / sub / cmp : en ligne, boucles entièrement déroulées ;
+ *   - depuisBigBinary / versBigBinary : conversion avec le type général ;
+ *   - montPreparer / montMul / expMod : Montgomery sans allocation
+ *     (bigbinary_fixe.c).
+ *
+ * Utilisation :
+ *   BigBinary2048 n, m, c;
+ *   BigBinary2048Mont M;
+ *   BigBinary2048_depuisBigBinary(&n, N);
+ *   BigBinary2048_depuisBigBinary(&m, message);
+ *   BigBinary2048_montPreparer(&M, &n);
+ *   BigBinary2048_expMod(&M, &c, &m, e);
+ *   BigBinary chiffre = BigBinary2048_versBigBinary(&c);
+ * ============================================================================
+ */
+
+#include "bigbinary.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BB_FIXE_DEROULER _Pragma("GCC unroll 64")
+#else
+#define BB_FIXE_DEROULER
+#endif
+
+/**
+ * BB_FIXE_DECLARER(BITS) : Type BigBinary<BITS> et ses fonctions
+ *
+ * BITS doit être un multiple de 64.
+ */
+#define BB_FIXE_DECLARER(BITS)                                                          \
+                                                                                        \
+typedef struct {                                                                        \
+    uint64_t Mots[(BITS) / 64];   /* 📌 Poids faible en premier, toujours BITS bits */    \
+} BigBinary##BITS;                                                                      \
+                                                                                        \
+typedef struct {                                                                        \
+    BigBinary##BITS N;            /* 📌 Module impair */                                 \
+    BigBinary##BITS R2;           /* 📌 R² mod N, R = 2^BITS */                          \
+    uint64_t n0;                  /* 📌 -N^(-1) mod 2^64 */                              \
+} BigBinary##BITS##Mont;                                                                \
+                                                                                        \
+/* r = a + b, retourne la retenue sortante (0 ou 1) ; r peut être a ou b */            \
+static inline uint64_t BigBinary##BITS##_add(BigBinary##BITS *r, const BigBinary##BITS *a, \
+                                             const BigBinary##BITS *b) {                \
+    uint64_t retenue = 0;                                                               \
+    BB_FIXE_DEROULER                                                                    \
+    for (int i = 0; i < (BITS) / 64; ++i) {                                             \
+        uint64_t s = a->Mots[i] + retenue;                                              \
+        retenue = (s < retenue);                                                        \
+        s += b->Mots[i];                                                                \
+        retenue += (s < b->Mots[i]);                                                    \
+        r->Mots[i] = s;                                                                 \
+    }                                                                                   \
+    return retenue;                                                                     \
+}                                                                                       \
+                                                                                        \
+/* r = a - b, retourne l'emprunt sortant (1 si a < b) ; r peut être a ou b */          \
+static inline uint64_t BigBinary##BITS##_sub(BigBinary##BITS *r, const BigBinary##BITS *a, \
+                                             const BigBinary##BITS *b) {                \
+    uint64_t emprunt = 0;                                                               \
+    BB_FIXE_DEROULER                                                                    \
+    for (int i = 0; i < (BITS) / 64; ++i) {                                             \
+        uint64_t x = a->Mots[i], y = b->Mots[i];                                        \
+        uint64_t d = x - y;                                                             \
+        uint64_t e = (x < y);                                                           \
+        r->Mots[i] = d - emprunt;                                                       \
+        emprunt = e | (d < emprunt);                                                    \
+    }                                                                                   \
+    return emprunt;                                                                     \
+}                                                                                       \
+                                                                                        \
+/* -1 si a < b, 0 si a = b, 1 si a > b (sans branchement par mot) */                   \
+static inline int BigBinary##BITS##_cmp(const BigBinary##BITS *a,                       \
+                                        const BigBinary##BITS *b) {                     \
+    int res = 0;                                                                        \
+    BB_FIXE_DEROULER                                                                    \
+    for (int i = 0; i < (BITS) / 64; ++i) {                                             \
+        int c = (a->Mots[i] > b->Mots[i]) - (a->Mots[i] < b->Mots[i]);                  \
+        res = c != 0 ? c : res;   /* le mot le plus fort qui diffère l'emporte */       \
+    }                                                                                   \
+    return res;                                                                         \
+}                                                                                       \
+                                                                                        \
+/* Copie A dans r : 1 si A tient sur BITS bits, 0 sinon (r est alors indéfini) */      \
+int BigBinary##BITS##_depuisBigBinary(BigBinary##BITS *r, const BigBinary A);           \
+                                                                                        \
+/* BigBinary normalisé égal à a (à libérer par l'appelant) */                           \
+BigBinary BigBinary##BITS##_versBigBinary(const BigBinary##BITS *a);                    \
+                                                                                        \
+/* Prépare le module N : 1 si N est impair, 0 sinon (Montgomery impossible) */          \
+int BigBinary##BITS##_montPreparer(BigBinary##BITS##Mont *M, const BigBinary##BITS *N); \
+                                                                                        \
+/* r = a × b × R^(-1) mod N, avec a < 2^BITS et b < N ; r peut être a ou b */          \
+void BigBinary##BITS##_montMul(const BigBinary##BITS##Mont *M, BigBinary##BITS *r,      \
+                               const BigBinary##BITS *a, const BigBinary##BITS *b);     \
+                                                                                        \
+/* r = base^exp mod N (base quelconque sur BITS bits) */                                \
+void BigBinary##BITS##_expMod(const BigBinary##BITS##Mont *M, BigBinary##BITS *r,       \
+                              const BigBinary##BITS *base, const BigBinary exp);
+
+BB_FIXE_DECLARER(256)
+BB_FIXE_DECLARER(512)
+BB_FIXE_DECLARER(1024)
+BB_FIXE_DECLARER(2048)
+BB_FIXE_DECLARER(4096)
+
+#endif // BIGBINARY_FIXE_H
@@ -0,0 +1,327 @@
+#ifndef BIGBINARY_INTERNE_H
+#define BIGBINARY_INTERNE_H
+
+/*
+ * Déclarations internes à la bibliothèque BigBinary.
+ * Ce fichier n'est PAS destiné aux programmes utilisateurs (main.c, outils) :
+ * seuls les fichiers bigbinary*.c l'incluent.
+ */
+
+#include "bigbinary.h"
+
+/* ===========================================================
+ *  ALLOCATION DES TABLEAUX DE CHIFFRES (bigbinary_arena.c)
+ * =========================================================== */
+
+/**
+ * bb_allouer() : Alloue un tableau pour Tdigits
+ *
+ * Si une arène est active sur le thread, le bloc vient de son pool
+ * (classes de tailles + allocation par incrément), sinon du tas.
+ * Chaque bloc porte un petit en-tête qui permet à bb_liberer() de savoir
+ * d'où il vient : on peut donc toujours libérer avec libereBigBinary().
+ */
+void *bb_allouer(size_t octets);
+
+/** bb_allouerZero() : Comme bb_allouer(), avec une mémoire mise à zéro */
+void *bb_allouerZero(size_t octets);
+
+/** bb_liberer() : Rend un bloc obtenu par bb_allouer() (NULL accepté) */
+void bb_liberer(void *p);
+
+/**
+ * Portée de calcul temporaire
+ *
+ * Les opérations lourdes (modulo, PGCD, exponentiation) encadrent leurs
+ * temporaires par bb_porteeOuvrir() / bb_porteeFermer() :
+ *   - si aucune arène n'est active, l'arène par défaut du thread est
+ *     activée pendant le calcul puis vidée d'un coup à la fermeture ;
+ *     le résultat est recopié sur le tas avant le vidage ;
+ *   - si une arène est déjà active (appelant ou portée englobante),
+ *     rien ne change et le résultat reste dans cette arène.
+ */
+typedef struct {
+    int ouverte;   // 1 si cette portée a activé l'arène du thread
+} BBPortee;
+
+BBPortee bb_porteeOuvrir(void);
+BigBinary bb_porteeFermer(BBPortee portee, BigBinary resultat);
+
+/* ===========================================================
+ *  ACCÈS AUX MOTS (bigbinary.c)
+ * =========================================================== */
+
+#define BB_BITS_MOT 64
+
+/** bb_mots() : Mots de A (stockage interne ou tableau), poids faible en premier */
+static inline uint64_t *bb_mots(BigBinary *A) {
+    return A->Tdigits != NULL ? A->Tdigits : A->Interne;
+}
+
+/** bb_motsC() : Version lecture seule de bb_mots() */
+static inline const uint64_t *bb_motsC(const BigBinary *A) {
+    return A->Tdigits != NULL ? A->Tdigits : A->Interne;
+}
+
+/** bb_clz64() : Nombre de zéros de tête d'un mot non nul */
+static inline int bb_clz64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(x);
+#else
+    int n = 0;
+    while (!(x & (1ULL << 63))) { x <<= 1; n++; }
+    return n;
+#endif
+}
+
+/** bb_ctz64() : Nombre de zéros de fin d'un mot non nul */
+static inline int bb_ctz64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    int n = 0;
+    while (!(x & 1ULL)) { x >>= 1; n++; }
+    return n;
+#endif
+}
+
+/** bb_bit() : Bit numéro i de A (0 = bit de poids faible) */
+static inline int bb_bit(const BigBinary *A, int i) {
+    int m = i / BB_BITS_MOT;
+    if (m >= A->Taille) return 0;
+    return (int)((bb_motsC(A)[m] >> (i % BB_BITS_MOT)) & 1u);
+}
+
+/**
+ * bb_tailleFenetre() : Largeur de fenêtre pour un exposant de nbBits bits
+ *
+ * Une fenêtre de k bits coûte 2^k produits de précalcul, et économise
+ * des multiplications pendant la boucle : seuils classiques.
+ */
+static inline int bb_tailleFenetre(int nbBits) {
+    if (nbBits > 671) return 5;
+    if (nbBits > 239) return 4;
+    if (nbBits > 79)  return 3;
+    if (nbBits > 23)  return 2;
+    return 1;
+}
+
+/** bb_extraireBits() : Les k bits de A à partir du bit "bas" (0 ≤ k ≤ 64), deux mots lus au plus */
+static inline uint64_t bb_extraireBits(const BigBinary *A, int bas, int k) {
+    int m = bas / BB_BITS_MOT, d = bas % BB_BITS_MOT;
+    if (k <= 0 || bas < 0 || m >= A->Taille) return 0;
+    const uint64_t *a = bb_motsC(A);
+    uint64_t v = a[m] >> d;
+    if (d != 0 && d + k > BB_BITS_MOT && m + 1 < A->Taille) v |= a[m + 1] << (BB_BITS_MOT - d);
+    return k >= BB_BITS_MOT ? v : v & ((1ULL << k) - 1);
+}
+
+/** bb_bitsExposant() : Valeur des k bits de E à partir du bit "bas" */
+static inline int bb_bitsExposant(const BigBinary *E, int bas, int k) {
+    return (int)bb_extraireBits(E, bas, k);
+}
+
+/**
+ * bb_creer() : Crée un BigBinary de nbMots mots, tous à zéro
+ *
+ * Le stockage interne est utilisé si nbMots ≤ BIGBINARY_MOTS_INTERNES.
+ * Le résultat n'est pas normalisé (Taille = nbMots).
+ */
+BigBinary bb_creer(int nbMots);
+
+/** bb_reserver() : Agrandit le stockage de A à au moins nbMots mots (contenu conservé) */
+void bb_reserver(BigBinary *A, int nbMots);
+
+/** bb_depuisMot() : BigBinary normalisé valant v */
+BigBinary bb_depuisMot(uint64_t v);
+
+/** bb_produit() : Produit complet A × B (normalisé) */
+BigBinary bb_produit(const BigBinary A, const BigBinary B);
+
+/** bb_quotient() : Quotient ⌊A / B⌋ (B > 0) */
+BigBinary bb_quotient(const BigBinary A, const BigBinary B);
+
+/**
+ * normalizeBigBinary() : Supprime les mots nuls de tête (voir bigbinary.c)
+ *
+ * Toute fonction qui écrit directement dans les mots d'un BigBinary doit
+ * remettre Normalise à 0 avant d'appeler normalizeBigBinary().
+ */
+void normalizeBigBinary(BigBinary *A);
+
+/** bb_motsUtiles() : Nombre de mots significatifs de A (0 pour zéro), même non normalisé */
+static inline int bb_motsUtiles(const BigBinary *A) {
+    const uint64_t *a = bb_motsC(A);
+    int n = A->Taille;
+    while (n > 0 && a[n - 1] == 0) n--;
+    return n;
+}
+
+/* ===========================================================
+ *  NOYAUX SUR TABLEAUX DE MOTS (bigbinary_noyaux.c)
+ * =========================================================== */
+
+/*
+ * bb_mulMots, bb_carreMots et bb_montMul passent par une table de
+ * fonctions remplie au premier appel : version BMI2/ADX si le CPU la
+ * supporte, version C portable sinon (voir BigBinary_noyaux()).
+ */
+
+/** bb_mul64() : Produit 64 × 64 → 128 bits (retourne le mot bas, *hi = mot haut) */
+static inline uint64_t bb_mul64(uint64_t a, uint64_t b, uint64_t *hi) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 p = (unsigned __int128)a * b;
+    *hi = (uint64_t)(p >> 64);
+    return (uint64_t)p;
+#else
+    uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t milieu = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (milieu >> 32);
+    return (milieu << 32) | (p00 & 0xFFFFFFFFu);
+#endif
+}
+
+/**
+ * bb_mulMots() : r = a × b (r : na + nb mots, ne doit chevaucher ni a ni b)
+ *
+ * Multiplication "schoolbook" mot par mot : O(na × nb).
+ */
+void bb_mulMots(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb);
+
+/** bb_carreMots() : r = a² (r : 2n mots) ; les produits croisés ne sont calculés qu'une fois */
+void bb_carreMots(uint64_t *r, const uint64_t *a, int n);
+
+/**
+ * BBModulo : diviseur préparé pour des réductions répétées
+ *
+ * La division de Knuth (algorithme D) demande un diviseur dont le bit de
+ * tête est à 1 : on le décale une fois pour toutes de s bits.
+ */
+typedef struct {
+    uint64_t *vn;   // diviseur décalé de s bits (mot de tête ≥ 2^63)
+    int nv;         // nombre de mots du diviseur
+    int s;          // décalage appliqué (0..63)
+} BBModulo;
+
+/** bb_moduloPreparer() : Prépare le diviseur v (nv mots, v[nv-1] ≠ 0) */
+void bb_moduloPreparer(BBModulo *M, const uint64_t *v, int nv);
+
+/** bb_moduloLiberer() : Libère un BBModulo */
+void bb_moduloLiberer(BBModulo *M);
+
+/**
+ * bb_moduloReduire() : Division de t (nt mots) par le diviseur préparé
+ *
+ *   - r (M->nv mots) reçoit le reste ;
+ *   - q (nt - nv + 1 mots, ou NULL) reçoit le quotient si nt ≥ nv ;
+ *   - t doit disposer d'un mot de marge (t[nt]) et est détruit.
+ */
+void bb_moduloReduire(const BBModulo *M, uint64_t *q, uint64_t *r, uint64_t *t, int nt);
+
+/**
+ * bb_divMots() : q = u / v, r = u mod v (q peut être NULL)
+ *
+ * u : nu mots, v : nv mots avec v[nv-1] ≠ 0 ; r : nv mots,
+ * q : nu - nv + 1 mots (si nu ≥ nv). u et v ne sont pas modifiés.
+ */
+void bb_divMots(uint64_t *q, uint64_t *r, const uint64_t *u, int nu, const uint64_t *v, int nv);
+
+/**
+ * BBMontgomery : constantes de Montgomery pour un module impair N
+ *
+ * Représentation : x̃ = x × R mod N avec R = 2^(64n). Un produit de
+ * Montgomery x̃ ỹ R^(-1) = (xy)~ remplace la division par des
+ * multiplications et un décalage de mots.
+ */
+typedef struct {
+    uint64_t *N;    // module (n mots, impair)
+    uint64_t *R2;   // R² mod N : x̃ = montMul(x, R2)
+    uint64_t n0;    // -N^(-1) mod 2^64
+    int n;          // nombre de mots
+} BBMontgomery;
+
+/** bb_montPreparer() : Calcule n0 et R² mod N (N impair, N[n-1] ≠ 0) */
+void bb_montPreparer(BBMontgomery *M, const uint64_t *N, int n);
+
+/** bb_montLiberer() : Libère un BBMontgomery */
+void bb_montLiberer(BBMontgomery *M);
+
+/**
+ * bb_montMul() : r = a × b × R^(-1) mod N
+ *
+ * a, b < N sur n mots ; r (n mots) peut être a ou b ; t : n + 2 mots de travail.
+ */
+void bb_montMul(const BBMontgomery *M, uint64_t *r, const uint64_t *a, const uint64_t *b,
+                uint64_t *t);
+
+/* ===========================================================
+ *  CACHE DES MODULES (bigbinary_cache.c)
+ * =========================================================== */
+
+/**
+ * BBContexteModule : tout ce qui ne dépend que du module N
+ *
+ *   - red  : diviseur normalisé pour la division de Knuth (tout module) ;
+ *   - mont : constantes de Montgomery (module impair ; mont.n = 0 sinon).
+ *
+ * Les autres champs appartiennent au cache. Un contexte obtenu est en
+ * lecture seule et peut être utilisé par plusieurs threads à la fois.
+ */
+typedef struct BBContexteModule {
+    BBModulo red;
+    BBMontgomery mont;
+
+    uint64_t hache;
+    uint64_t *N;                  // copie exacte du module (comparaison)
+    int references;               // utilisateurs + 1 tant qu'il est en cache
+    struct BBContexteModule *seauSuivant;
+    struct BBContexteModule *lruPrec, *lruSuiv;
+} BBContexteModule;
+
+/**
+ * bb_moduleObtenir() : Contexte du module N (n mots, N[n-1] ≠ 0)
+ *
+ * Pris dans le cache ou préparé (puis mis en cache). À rendre par
+ * bb_moduleRendre() une fois le calcul fini.
+ */
+const BBContexteModule *bb_moduleObtenir(const uint64_t *N, int n);
+
+/** bb_moduleRendre() : Rend un contexte obtenu par bb_moduleObtenir() */
+void bb_moduleRendre(const BBContexteModule *C);
+
+/* ===========================================================
+ *  INSTRUMENTATION (bigbinary_stats.c)
+ * =========================================================== */
+
+/*
+ * BB_STAT_DEBUT(prim)        : début d'une primitive chronométrée
+ * BB_STAT_FIN(prim, mots)    : à placer avant chaque return de la primitive
+ * BB_STAT_COMPTER(prim, mots): appel compté sans chronomètre
+ * BB_STAT_ALLOC(octets, tas) : allocation d'un tableau de mots
+ *
+ * Sans BIGBINARY_INSTRUMENTATION, ces macros ne produisent aucun code.
+ */
+#ifdef BIGBINARY_INSTRUMENTATION
+
+uint64_t bb_statHorloge(void);
+void bb_statAjouter(BigBinaryPrimitive p, uint64_t mots, uint64_t cycles);
+void bb_statAllocation(size_t octets, int surLeTas);
+
+#define BB_STAT_DEBUT(prim)        uint64_t bb_stat_t0_ = bb_statHorloge()
+#define BB_STAT_FIN(prim, mots)    bb_statAjouter((prim), (uint64_t)(mots), \
+                                                  bb_statHorloge() - bb_stat_t0_)
+#define BB_STAT_COMPTER(prim, mots) bb_statAjouter((prim), (uint64_t)(mots), 0)
+#define BB_STAT_ALLOC(octets, tas) bb_statAllocation((octets), (tas))
+
+#else
+
+#define BB_STAT_DEBUT(prim)         ((void)0)
+#define BB_STAT_FIN(prim, mots)     ((void)0)
+#define BB_STAT_COMPTER(prim, mots) ((void)0)
+#define BB_STAT_ALLOC(octets, tas)  ((void)0)
+
+#endif
+
+#endif // BIGBINARY_INTERNE_H
@@ -0,0 +1,417 @@
+#include "bigbinary_interne.h"
+#include <pthread.h>
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BB_LOT_X86 1
+#include <immintrin.h>
+#endif
+
+/*
+ * ============================================================================
+ * EXPONENTIATION MODULAIRE PAR LOTS (SIMD)
+ * ============================================================================
+ *
+ * Un lot RSA applique la même suite d'opérations (même exposant, même
+ * module) à des messages indépendants : on les calcule en parallèle, un
+ * message par voie d'un registre vectoriel.
+ *
+ * Chaque nombre est découpé en s "chiffres" de w bits, rangés par chiffre
+ * puis par voie : v[j × voies + l] = chiffre j du message l. Un produit de
+ * Montgomery traite ainsi toutes les voies à la fois.
+ *
+ *   Moteur       voies   w    instruction
+ *   avx512ifma     8     52   vpmadd52luq / vpmadd52huq (52 × 52 → 104 bits)
+ *   avx2           4     26   vpmuludq (32 × 32 → 64 bits, produit complet)
+ *   scalaire       1     -    BigBinary_expMod message par message
+ *
+ * Les chiffres d'un accumulateur ne sont pas propagés à chaque produit :
+ * un mot de 64 bits reçoit au plus 4s produits de 52 bits (ou 2s de 52 bits)
+ * avant la normalisation finale, d'où la limite de taille BITS_MAX_LOT.
+ *
+ * R = 2^(w·s) est choisi > 4N : avec des entrées < 2N, le produit de
+ * Montgomery reste < 2N sans soustraction conditionnelle (impossible à
+ * faire voie par voie sans comparer tous les chiffres). La réduction
+ * finale sous N se fait sur le résultat converti.
+ *
+ * Le moteur est choisi une fois, à la première utilisation, selon le CPU.
+ * ============================================================================
+ */
+
+#define BITS_MAX_LOT  16384
+
+/* Module préparé pour un moteur donné */
+typedef struct {
+    int s;              // chiffres par nombre
+    int voies;
+    int w;              // bits par chiffre
+    uint64_t masque;    // 2^w - 1
+    uint64_t n0;        // -N^(-1) mod 2^w
+    uint64_t *N;        // module, diffusé dans chaque voie (s × voies)
+} ContexteLot;
+
+/* r = a × b × R^(-1) mod N sur toutes les voies ; T : 2s × voies mots de travail */
+typedef void (*MontMulLot)(const ContexteLot *C, uint64_t *r, const uint64_t *a,
+                           const uint64_t *b, uint64_t *T);
+
+typedef struct {
+    const char *nom;
+    int voies;
+    int w;
+    MontMulLot montMul;
+    int (*disponible)(void);
+} MoteurLot;
+
+/* ===========================================================
+ *  Noyau AVX-512 IFMA : 8 voies, chiffres de 52 bits
+ * =========================================================== */
+
+#ifdef BB_LOT_X86
+
+/**
+ * montMulIfma - Produit de Montgomery sur 8 voies (méthode CIOS)
+ *
+ * Au tour i, la colonne T[i+j] reçoit en une seule passe :
+ *   lo(a_j b_i) + hi(a_(j-1) b_i) + lo(N_j m) + hi(N_(j-1) m)
+ * où m = T[i] × n0 mod 2^52 annule le chiffre bas ; la retenue de T[i]
+ * passe dans T[i+1]. Le résultat est dans T[s..2s-1].
+ */
+__attribute__((target("avx512f,avx512ifma")))
+static void montMulIfma(const ContexteLot *C, uint64_t *r, const uint64_t *a,
+                        const uint64_t *b, uint64_t *T) {
+    const int s = C->s;
+    const __m512i masque = _mm512_set1_epi64((long long)C->masque);
+    const __m512i n0 = _mm512_set1_epi64((long long)C->n0);
+    const __m512i zero = _mm512_setzero_si512();
+    const uint64_t *N = C->N;
+
+    for (int j = 0; j < 2 * s; ++j) _mm512_storeu_si512((void*)(T + 8 * j), zero);
+
+    for (int i = 0; i < s; ++i) {
+        __m512i bi = _mm512_loadu_si512((const void*)(b + 8 * i));
+        uint64_t *t = T + 8 * i;
+
+        // Chiffre bas : m, puis retenue
+        __m512i a0 = _mm512_loadu_si512((const void*)a);
+        __m512i N0 = _mm512_loadu_si512((const void*)N);
+        __m512i t0 = _mm512_madd52lo_epu64(_mm512_loadu_si512((const void*)t), a0, bi);
+        __m512i m = _mm512_and_si512(_mm512_madd52lo_epu64(zero, t0, n0), masque);
+        t0 = _mm512_madd52lo_epu64(t0, N0, m);
+        __m512i retenue = _mm512_srli_epi64(t0, 52);
+
+        // Colonnes suivantes
+        __m512i aPrec = a0, NPrec = N0;
+        for (int j = 1; j < s; ++j) {
+            __m512i aj = _mm512_loadu_si512((const void*)(a + 8 * j));
+            __m512i Nj = _mm512_loadu_si512((const void*)(N + 8 * j));
+            __m512i v = _mm512_loadu_si512((const void*)(t + 8 * j));
+            v = _mm512_madd52lo_epu64(v, aj, bi);
+            v = _mm512_madd52hi_epu64(v, aPrec, bi);
+            v = _mm512_madd52lo_epu64(v, Nj, m);
+            v = _mm512_madd52hi_epu64(v, NPrec, m);
+            if (j == 1) v = _mm512_add_epi64(v, retenue);
+            _mm512_storeu_si512((void*)(t + 8 * j), v);
+            aPrec = aj;
+            NPrec = Nj;
+        }
+        __m512i v = _mm512_loadu_si512((const void*)(t + 8 * s));
+        v = _mm512_madd52hi_epu64(v, aPrec, bi);
+        v = _mm512_madd52hi_epu64(v, NPrec, m);
+        if (s == 1) v = _mm512_add_epi64(v, retenue);
+        _mm512_storeu_si512((void*)(t + 8 * s), v);
+    }
+
+    // Normalisation : propager les retenues de T[s..2s-1]
+    __m512i c = zero;
+    for (int j = 0; j < s; ++j) {
+        __m512i v = _mm512_add_epi64(_mm512_loadu_si512((const void*)(T + 8 * (s + j))), c);
+        _mm512_storeu_si512((void*)(r + 8 * j), _mm512_and_si512(v, masque));
+        c = _mm512_srli_epi64(v, 52);
+    }
+}
+
+static int dispoIfma(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+}
+
+/* ===========================================================
+ *  Noyau AVX2 : 4 voies, chiffres de 26 bits
+ * =========================================================== */
+
+/**
+ * montMulAvx2 - Produit de Montgomery sur 4 voies
+ *
+ * vpmuludq multiplie les 32 bits bas de chaque voie : avec des chiffres de
+ * 26 bits le produit (52 bits) est complet, pas de partie haute à suivre.
+ */
+__attribute__((target("avx2")))
+static void montMulAvx2(const ContexteLot *C, uint64_t *r, const uint64_t *a,
+                        const uint64_t *b, uint64_t *T) {
+    const int s = C->s;
+    const __m256i masque = _mm256_set1_epi64x((long long)C->masque);
+    const __m256i n0 = _mm256_set1_epi64x((long long)C->n0);
+    const __m256i zero = _mm256_setzero_si256();
+    const uint64_t *N = C->N;
+
+    for (int j = 0; j < 2 * s; ++j) _mm256_storeu_si256((__m256i*)(T + 4 * j), zero);
+
+    for (int i = 0; i < s; ++i) {
+        __m256i bi = _mm256_loadu_si256((const __m256i*)(b + 4 * i));
+        uint64_t *t = T + 4 * i;
+
+        __m256i t0 = _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)t),
+                                      _mm256_mul_epu32(_mm256_loadu_si256((const __m256i*)a), bi));
+        __m256i m = _mm256_and_si256(_mm256_mul_epu32(t0, n0), masque);
+        t0 = _mm256_add_epi64(t0, _mm256_mul_epu32(_mm256_loadu_si256((const __m256i*)N), m));
+        __m256i retenue = _mm256_srli_epi64(t0, 26);
+
+        for (int j = 1; j < s; ++j) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(t + 4 * j));
+            v = _mm256_add_epi64(v, _mm256_mul_epu32(_mm256_loadu_si256((const __m256i*)(a + 4 * j)), bi));
+            v = _mm256_add_epi64(v, _mm256_mul_epu32(_mm256_loadu_si256((const __m256i*)(N + 4 * j)), m));
+            if (j == 1) v = _mm256_add_epi64(v, retenue);
+            _mm256_storeu_si256((__m256i*)(t + 4 * j), v);
+        }
+        if (s == 1) {
+            __m256i v = _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)(t + 4)), retenue);
+            _mm256_storeu_si256((__m256i*)(t + 4), v);
+        }
+    }
+
+    __m256i c = zero;
+    for (int j = 0; j < s; ++j) {
+        __m256i v = _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)(T + 4 * (s + j))), c);
+        _mm256_storeu_si256((__m256i*)(r + 4 * j), _mm256_and_si256(v, masque));
+        c = _mm256_srli_epi64(v, 26);
+    }
+}
+
+static int dispoAvx2(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif /* BB_LOT_X86 */
+
+static int dispoScalaire(void) {
+    return 1;
+}
+
+/* Du plus rapide au plus lent : le premier disponible est retenu */
+static const MoteurLot MOTEURS[] = {
+#ifdef BB_LOT_X86
+    { "avx512ifma", 8, 52, montMulIfma, dispoIfma },
+    { "avx2",       4, 26, montMulAvx2, dispoAvx2 },
+#endif
+    { "scalaire",   1, 0,  NULL,        dispoScalaire },
+};
+#define NB_MOTEURS ((int)(sizeof(MOTEURS) / sizeof(MOTEURS[0])))
+
+static const MoteurLot *moteurActif = NULL;
+static pthread_once_t moteurUneFois = PTHREAD_ONCE_INIT;
+
+static void detecterMoteur(void) {
+    for (int i = 0; i < NB_MOTEURS; ++i) {
+        if (MOTEURS[i].disponible()) {
+            moteurActif = &MOTEURS[i];
+            return;
+        }
+    }
+}
+
+static const MoteurLot *moteur(void) {
+    pthread_once(&moteurUneFois, detecterMoteur);
+    return moteurActif;
+}
+
+const char *BigBinary_moteurLot(void) {
+    return moteur()->nom;
+}
+
+int BigBinary_choisirMoteurLot(const char *nom) {
+    moteur();   // détection faite avant de la remplacer
+    for (int i = 0; i < NB_MOTEURS; ++i) {
+        if (strcmp(MOTEURS[i].nom, nom) == 0 && MOTEURS[i].disponible()) {
+            moteurActif = &MOTEURS[i];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* ===========================================================
+ *  Conversions BigBinary ↔ chiffres de w bits
+ * =========================================================== */
+
+/* Range les s chiffres de A dans la voie l de v */
+static void versChiffres(const BigBinary *A, const ContexteLot *C, uint64_t *v, int l) {
+    const uint64_t *a = bb_motsC(A);
+    int na = bb_motsUtiles(A);
+
+    for (int j = 0; j < C->s; ++j) {
+        int bit = j * C->w;
+        int m = bit / BB_BITS_MOT, d = bit % BB_BITS_MOT;
+        uint64_t x = 0;
+        if (m < na) {
+            x = a[m] >> d;
+            if (d + C->w > BB_BITS_MOT && m + 1 < na) x |= a[m + 1] << (BB_BITS_MOT - d);
+        }
+        v[j * C->voies + l] = x & C->masque;
+    }
+}
+
+/* Reconstruit le BigBinary de la voie l de v (chiffres normalisés) */
+static BigBinary depuisChiffres(const uint64_t *v, const ContexteLot *C, int l) {
+    int nbMots = (C->s * C->w + BB_BITS_MOT - 1) / BB_BITS_MOT + 1;
+    BigBinary A = bb_creer(nbMots);
+    uint64_t *a = bb_mots(&A);
+
+    for (int j = 0; j < C->s; ++j) {
+        uint64_t x = v[j * C->voies + l];
+        int bit = j * C->w;
+        int m = bit / BB_BITS_MOT, d = bit % BB_BITS_MOT;
+        a[m] |= x << d;
+        if (d + C->w > BB_BITS_MOT) a[m + 1] |= x >> (BB_BITS_MOT - d);
+    }
+    normalizeBigBinary(&A);
+    return A;
+}
+
+/* ===========================================================
+ *  Exponentiation d'un groupe de voies
+ * =========================================================== */
+
+/**
+ * expGroupe - Un groupe de "voies" messages (les voies vides valent 0)
+ *
+ * ÉTAPES (comme expModMontgomery, mais sur toutes les voies) :
+ *   1. base~ = montMul(base, R² mod N), 1~ = montMul(1, R² mod N)
+ *   2. table des puissances base~^i, i < 2^k
+ *   3. fenêtres de k bits de gauche à droite
+ *   4. retour en représentation normale (montMul par 1) et réduction < N
+ */
+static void expGroupe(const MoteurLot *E, const ContexteLot *C, const BigBinary *messages,
+                      BigBinary *resultats, int nb, const BigBinary *exp, const BigBinary *mod,
+                      const uint64_t *R2, int k) {
+    int s = C->s, V = C->voies;
+    size_t taille = (size_t)s * V;
+
+    uint64_t *table = (uint64_t*)bb_allouer(((size_t)1 << k) * taille * sizeof(uint64_t));
+    uint64_t *acc = (uint64_t*)bb_allouer(taille * sizeof(uint64_t));
+    uint64_t *un = (uint64_t*)bb_allouerZero(taille * sizeof(uint64_t));
+    uint64_t *T = (uint64_t*)bb_allouer(2 * taille * sizeof(uint64_t));
+
+    // ÉTAPE 1 : messages réduits (< N) dans table[1], 1 dans "un"
+    uint64_t *base = table + taille;
+    memset(base, 0, taille * sizeof(uint64_t));
+    for (int l = 0; l < nb; ++l) {
+        BigBinary x = Inferieur(messages[l], *mod) ? copieBigBinary(messages[l])
+                                                   : BigBinary_mod(messages[l], *mod);
+        versChiffres(&x, C, base, l);
+        libereBigBinary(&x);
+    }
+    for (int l = 0; l < V; ++l) un[l] = 1;
+
+    E->montMul(C, table, un, R2, T);        // 1~
+    E->montMul(C, base, base, R2, T);       // base~
+
+    // ÉTAPE 2 : table
+    for (int i = 2; i < (1 << k); ++i)
+        E->montMul(C, table + (size_t)i * taille, table + (size_t)(i - 1) * taille, base, T);
+
+    // ÉTAPE 3 : fenêtres (exposant commun : toutes les voies suivent le même chemin)
+    int nbBits = BigBinary_nbBits(*exp);
+    int reste = nbBits % k ? nbBits % k : k;
+    int pos = nbBits - reste;
+    memcpy(acc, table + (size_t)bb_bitsExposant(exp, pos, reste) * taille, taille * sizeof(uint64_t));
+    while (pos > 0) {
+        pos -= k;
+        for (int j = 0; j < k; ++j) E->montMul(C, acc, acc, acc, T);
+        int v = bb_bitsExposant(exp, pos, k);
+        if (v) E->montMul(C, acc, acc, table + (size_t)v * taille, T);
+    }
+
+    // ÉTAPE 4 : sortie de la représentation de Montgomery (résultat ≤ N)
+    E->montMul(C, acc, acc, un, T);
+    for (int l = 0; l < nb; ++l) {
+        BigBinary y = depuisChiffres(acc, C, l);
+        if (!Inferieur(y, *mod)) {
+            BigBinary z = soustractionBigBinary(y, *mod);
+            libereBigBinary(&y);
+            y = z;
+        }
+        resultats[l] = y;
+    }
+
+    bb_liberer(T);
+    bb_liberer(un);
+    bb_liberer(acc);
+    bb_liberer(table);
+}
+
+/**
+ * BigBinary_expModLot - resultats[i] = messages[i]^exp mod mod, pour i < k
+ *
+ * Les messages sont traités par groupes de "voies" (8 ou 4) avec le moteur
+ * SIMD choisi au démarrage ; cas particuliers (module pair ou trop grand,
+ * exposant nul, un seul message) et moteur scalaire : BigBinary_expMod.
+ *
+ * @param messages : Les k bases
+ * @param resultats : Reçoit les k résultats (à libérer par l'appelant)
+ * @param k : Nombre de messages
+ * @param exp : Exposant commun
+ * @param mod : Module commun
+ */
+void BigBinary_expModLot(const BigBinary *messages, BigBinary *resultats, int k,
+                         const BigBinary exp, const BigBinary mod) {
+    if (k <= 0) return;
+    const MoteurLot *E = moteur();
+    int bitsMod = BigBinary_nbBits(mod);
+
+    // CAS 1 : hors du domaine du moteur vectoriel → message par message
+    if (E->montMul == NULL || k == 1 || estPair(mod) || bitsMod < 2 ||
+        bitsMod > BITS_MAX_LOT || estZero(exp)) {
+        for (int i = 0; i < k; ++i) resultats[i] = BigBinary_expMod(messages[i], exp, mod);
+        return;
+    }
+
+    // ÉTAPE 1 : contexte du module (R = 2^(w·s) > 4N)
+    ContexteLot C;
+    C.voies = E->voies;
+    C.w = E->w;
+    C.masque = ((uint64_t)1 << C.w) - 1;
+    C.s = (bitsMod + 2 + C.w - 1) / C.w;
+
+    uint64_t N0 = bb_motsC(&mod)[0];
+    uint64_t x = N0;
+    for (int i = 0; i < 5; ++i) x *= 2 - N0 * x;   // N0^(-1) mod 2^64
+    C.n0 = ((uint64_t)0 - x) & C.masque;
+
+    size_t taille = (size_t)C.s * C.voies;
+    C.N = (uint64_t*)bb_allouer(taille * sizeof(uint64_t));
+    uint64_t *R2 = (uint64_t*)bb_allouer(taille * sizeof(uint64_t));
+
+    // R² mod N, diffusé comme N dans toutes les voies
+    BigBinary un = initBigBinaryFromString("1");
+    BigBinary R2big = decaleGauche(un, 2 * C.w * C.s);
+    BigBinary R2mod = BigBinary_mod(R2big, mod);
+    for (int l = 0; l < C.voies; ++l) {
+        versChiffres(&mod, &C, C.N, l);
+        versChiffres(&R2mod, &C, R2, l);
+    }
+    libereBigBinary(&R2mod);
+    libereBigBinary(&R2big);
+    libereBigBinary(&un);
+
+    // ÉTAPE 2 : groupes de voies
+    int bitsExp = BigBinary_nbBits(exp);
+    int fenetre = bb_tailleFenetre(bitsExp);
+    for (int i = 0; i < k; i += C.voies) {
+        int nb = (k - i < C.voies) ? k - i : C.voies;
+        expGroupe(E, &C, messages + i, resultats + i, nb, &exp, &mod, R2, fenetre);
+    }
+
+    bb_liberer(R2);
+    bb_liberer(C.N);
+}
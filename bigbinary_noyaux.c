@@ -0,0 +1,630 @@
+#include "bigbinary_interne.h"
+#include <pthread.h>
+#include <string.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BB_NOYAUX_X86 1
+#include <cpuid.h>
+#endif
+
+/*
+ * ============================================================================
+ * NOYAUX ARITHMÉTIQUES SUR TABLEAUX DE MOTS
+ * ============================================================================
+ *
+ * Multiplication et division de grands nombres donnés comme tableaux de
+ * mots de 64 bits (poids faible en premier), sans structure BigBinary :
+ * les fonctions de bigbinary.c les appellent sur bb_mots() de leurs
+ * opérandes et sur des tampons préparés une seule fois.
+ *
+ * Les noyaux les plus sollicités (multiplication, carré, produit de
+ * Montgomery) existent en deux versions, choisies une fois au démarrage
+ * selon le CPU (voir "Choix des noyaux" en fin de fichier) :
+ *   - portable : C pur, produits 64 × 64 → 128 par bb_mul64() ;
+ *   - bmi2-adx : mulx / adcx / adox (x86-64 récents), deux chaînes de
+ *     retenues indépendantes dans la même boucle.
+ *
+ * Référence : D. Knuth, TAOCP vol. 2, §4.3.1 (algorithmes M et D).
+ * ============================================================================
+ */
+
+/* ===========================================================
+ *  Division 128 / 64
+ * =========================================================== */
+
+/**
+ * div128 - Quotient de (hi:lo) par d, avec hi < d (le quotient tient sur 64 bits)
+ *
+ * @param reste : Reçoit (hi:lo) mod d
+ */
+static uint64_t div128(uint64_t hi, uint64_t lo, uint64_t d, uint64_t *reste) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 n = ((unsigned __int128)hi << 64) | lo;
+    *reste = (uint64_t)(n % d);
+    return (uint64_t)(n / d);
+#else
+    // Division binaire : un bit de quotient par tour
+    uint64_t q = 0;
+    for (int i = 63; i >= 0; --i) {
+        int haut = (int)(hi >> 63);
+        hi = (hi << 1) | (lo >> 63);
+        lo <<= 1;
+        q <<= 1;
+        if (haut || hi >= d) {
+            hi -= d;
+            q |= 1;
+        }
+    }
+    *reste = hi;
+    return q;
+#endif
+}
+
+/* ===========================================================
+ *  Multiplication
+ * =========================================================== */
+
+/**
+ * mulMotsPortable - r = a × b (algorithme M de Knuth)
+ *
+ * Pour chaque mot a[i], on ajoute a[i] × b décalé de i mots. La retenue
+ * tient toujours sur un mot : a×b + r + c ≤ (2^64 - 1)² + 2(2^64 - 1) < 2^128.
+ */
+static void mulMotsPortable(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb) {
+    memset(r, 0, (size_t)(na + nb) * sizeof(uint64_t));
+
+    for (int i = 0; i < na; ++i) {
+        uint64_t ai = a[i];
+        if (ai == 0) continue;
+
+        uint64_t retenue = 0;
+        for (int j = 0; j < nb; ++j) {
+            uint64_t hi;
+            uint64_t lo = bb_mul64(ai, b[j], &hi);
+            lo += r[i + j];
+            hi += (lo < r[i + j]);
+            lo += retenue;
+            hi += (lo < retenue);
+            r[i + j] = lo;
+            retenue = hi;
+        }
+        r[i + nb] = retenue;
+    }
+}
+
+/**
+ * doublerEtDiagonale - Fin du carré : r = 2r + Σ a[i]² × 2^(128i)
+ *
+ * r (2n mots) contient les produits croisés ; commun aux deux versions.
+ */
+static void doublerEtDiagonale(uint64_t *r, const uint64_t *a, int n) {
+    // ÉTAPE 2 : doubler
+    uint64_t sortant = 0;
+    for (int i = 0; i < 2 * n; ++i) {
+        uint64_t m = r[i];
+        r[i] = (m << 1) | sortant;
+        sortant = m >> 63;
+    }
+
+    // ÉTAPE 3 : ajouter les carrés de la diagonale
+    uint64_t retenue = 0;
+    for (int i = 0; i < n; ++i) {
+        uint64_t hi;
+        uint64_t lo = bb_mul64(a[i], a[i], &hi);
+
+        uint64_t s = r[2 * i] + lo;
+        uint64_t c = (s < lo);
+        s += retenue;
+        c += (s < retenue);
+        r[2 * i] = s;
+
+        uint64_t t = r[2 * i + 1] + hi;
+        uint64_t c2 = (t < hi);
+        t += c;
+        c2 += (t < c);
+        r[2 * i + 1] = t;
+        retenue = c2;
+    }
+}
+
+/**
+ * carreMotsPortable - r = a²
+ *
+ * a² = Σ a[i]² × 2^(128i) + 2 × Σ(i<j) a[i]a[j] × 2^(64(i+j)) :
+ *   1. produits croisés (i < j) seulement : moitié des multiplications ;
+ *   2. doublement par un décalage d'un bit ;
+ *   3. ajout des carrés a[i]² sur la diagonale.
+ */
+static void carreMotsPortable(uint64_t *r, const uint64_t *a, int n) {
+    memset(r, 0, (size_t)(2 * n) * sizeof(uint64_t));
+
+    // ÉTAPE 1 : produits croisés
+    for (int i = 0; i < n; ++i) {
+        uint64_t ai = a[i];
+        uint64_t retenue = 0;
+        for (int j = i + 1; j < n; ++j) {
+            uint64_t hi;
+            uint64_t lo = bb_mul64(ai, a[j], &hi);
+            lo += r[i + j];
+            hi += (lo < r[i + j]);
+            lo += retenue;
+            hi += (lo < retenue);
+            r[i + j] = lo;
+            retenue = hi;
+        }
+        r[i + n] = retenue;
+    }
+
+    doublerEtDiagonale(r, a, n);
+}
+
+/* ===========================================================
+ *  Division (algorithme D de Knuth)
+ * =========================================================== */
+
+/**
+ * divNoyau - Division de un (nu + 1 mots) par vn (nv mots, normalisé)
+ *
+ * Après l'appel, un[0..nv-1] contient le reste (encore décalé de s bits)
+ * et q[0..nu-nv] le quotient (si q ≠ NULL).
+ *
+ * PRINCIPE : pour chaque mot de quotient (du plus fort au plus faible) :
+ *   1. estimer q̂ avec les deux mots de tête du reste partiel et le mot de
+ *      tête du diviseur (grâce à la normalisation, q̂ dépasse au plus de 2) ;
+ *   2. corriger q̂ avec le deuxième mot du diviseur ;
+ *   3. soustraire q̂ × vn ; si le résultat est négatif (rare), rajouter vn.
+ */
+static void divNoyau(uint64_t *q, uint64_t *un, int nu, const uint64_t *vn, int nv) {
+    uint64_t vTete = vn[nv - 1];
+
+    // CAS 1 : diviseur d'un seul mot → division courte
+    if (nv == 1) {
+        uint64_t reste = un[nu];
+        for (int j = nu - 1; j >= 0; --j) {
+            uint64_t qj = div128(reste, un[j], vTete, &reste);
+            if (q) q[j] = qj;
+        }
+        un[0] = reste;
+        return;
+    }
+
+    uint64_t vSuivant = vn[nv - 2];
+
+    // CAS 2 : cas général
+    for (int j = nu - nv; j >= 0; --j) {
+        // ÉTAPE 1 : estimation de q̂ (un[j+nv] ≤ vTete par construction)
+        uint64_t qhat, rhat;
+        int rhatDeborde = 0;
+        if (un[j + nv] >= vTete) {
+            qhat = ~0ULL;
+            rhat = un[j + nv - 1] + vTete;      // (un[j+nv]:un[j+nv-1]) - qhat × vTete
+            rhatDeborde = (rhat < vTete);
+        } else {
+            qhat = div128(un[j + nv], un[j + nv - 1], vTete, &rhat);
+        }
+
+        // ÉTAPE 2 : correction tant que q̂ × vSuivant > (rhat : un[j+nv-2])
+        while (!rhatDeborde) {
+            uint64_t hi;
+            uint64_t lo = bb_mul64(qhat, vSuivant, &hi);
+            if (hi < rhat || (hi == rhat && lo <= un[j + nv - 2])) break;
+            qhat--;
+            rhat += vTete;
+            rhatDeborde = (rhat < vTete);
+        }
+
+        // ÉTAPE 3 : un[j..j+nv] -= q̂ × vn
+        uint64_t retenue = 0, emprunt = 0;
+        for (int i = 0; i < nv; ++i) {
+            uint64_t hi;
+            uint64_t lo = bb_mul64(qhat, vn[i], &hi);
+            lo += retenue;
+            hi += (lo < retenue);
+            retenue = hi;
+
+            uint64_t u = un[i + j];
+            uint64_t d = u - lo;
+            uint64_t e1 = (u < lo);
+            uint64_t d2 = d - emprunt;
+            uint64_t e2 = (d < emprunt);
+            un[i + j] = d2;
+            emprunt = e1 + e2;
+        }
+        uint64_t u = un[j + nv];
+        uint64_t d = u - retenue;
+        uint64_t e1 = (u < retenue);
+        uint64_t d2 = d - emprunt;
+        uint64_t e2 = (d < emprunt);
+        un[j + nv] = d2;
+
+        // Résultat négatif : q̂ était trop grand de 1, on rajoute vn
+        if (e1 | e2) {
+            qhat--;
+            uint64_t c = 0;
+            for (int i = 0; i < nv; ++i) {
+                uint64_t s = un[i + j] + c;
+                c = (s < c);
+                s += vn[i];
+                c += (s < vn[i]);
+                un[i + j] = s;
+            }
+            un[j + nv] += c;
+        }
+
+        if (q) q[j] = qhat;
+    }
+}
+
+void bb_moduloPreparer(BBModulo *M, const uint64_t *v, int nv) {
+    M->nv = nv;
+    M->s = bb_clz64(v[nv - 1]);
+    M->vn = (uint64_t*)bb_allouer((size_t)nv * sizeof(uint64_t));
+
+    // vn = v << s (s < 64 : le mot de tête ne déborde pas)
+    int s = M->s;
+    for (int i = nv - 1; i > 0; --i)
+        M->vn[i] = s ? (v[i] << s) | (v[i - 1] >> (64 - s)) : v[i];
+    M->vn[0] = v[0] << s;
+}
+
+void bb_moduloLiberer(BBModulo *M) {
+    bb_liberer(M->vn);
+    M->vn = NULL;
+    M->nv = 0;
+}
+
+void bb_moduloReduire(const BBModulo *M, uint64_t *q, uint64_t *r, uint64_t *t, int nt) {
+    int nv = M->nv, s = M->s;
+
+    // Dividende plus court que le diviseur : c'est déjà le reste
+    if (nt < nv) {
+        memmove(r, t, (size_t)nt * sizeof(uint64_t));
+        memset(r + nt, 0, (size_t)(nv - nt) * sizeof(uint64_t));
+        return;
+    }
+
+    // t <<= s, dans nt + 1 mots
+    t[nt] = s ? t[nt - 1] >> (64 - s) : 0;
+    if (s) {
+        for (int i = nt - 1; i > 0; --i) t[i] = (t[i] << s) | (t[i - 1] >> (64 - s));
+        t[0] <<= s;
+    }
+
+    divNoyau(q, t, nt, M->vn, nv);
+
+    // Reste : les nv mots de poids faible, décalés de s vers la droite
+    for (int i = 0; i < nv - 1; ++i)
+        r[i] = s ? (t[i] >> s) | (t[i + 1] << (64 - s)) : t[i];
+    r[nv - 1] = t[nv - 1] >> s;
+}
+
+void bb_divMots(uint64_t *q, uint64_t *r, const uint64_t *u, int nu, const uint64_t *v, int nv) {
+    BBModulo M;
+    bb_moduloPreparer(&M, v, nv);
+
+    // Copie de travail de u avec un mot de marge
+    uint64_t *t = (uint64_t*)bb_allouer((size_t)(nu + 1) * sizeof(uint64_t));
+    memcpy(t, u, (size_t)nu * sizeof(uint64_t));
+
+    bb_moduloReduire(&M, q, r, t, nu);
+
+    bb_liberer(t);
+    bb_moduloLiberer(&M);
+}
+
+/* ===========================================================
+ *  Multiplication de Montgomery (module impair)
+ * =========================================================== */
+
+/**
+ * bb_montPreparer - Constantes de Montgomery pour le module impair N
+ *
+ * ÉTAPES :
+ *   1. n0 = -N^(-1) mod 2^64 par Newton : x ← x(2 - N₀x) double le
+ *      nombre de bits justes (N₀ impair : x = N₀ est juste sur 3 bits)
+ *   2. R² mod N (R = 2^(64n)) par une division longue de 2^(128n)
+ */
+void bb_montPreparer(BBMontgomery *M, const uint64_t *N, int n) {
+    M->n = n;
+    M->N = (uint64_t*)bb_allouer((size_t)n * sizeof(uint64_t));
+    M->R2 = (uint64_t*)bb_allouer((size_t)n * sizeof(uint64_t));
+    memcpy(M->N, N, (size_t)n * sizeof(uint64_t));
+
+    // ÉTAPE 1 : inverse de N₀ modulo 2^64
+    uint64_t x = N[0];
+    for (int i = 0; i < 5; ++i) x *= 2 - N[0] * x;   // 3 → 6 → 12 → 24 → 48 → 96 bits
+    M->n0 = (uint64_t)0 - x;
+
+    // ÉTAPE 2 : R² mod N
+    uint64_t *u = (uint64_t*)bb_allouerZero((size_t)(2 * n + 1) * sizeof(uint64_t));
+    u[2 * n] = 1;
+    bb_divMots(NULL, M->R2, u, 2 * n + 1, N, n);
+    bb_liberer(u);
+}
+
+void bb_montLiberer(BBMontgomery *M) {
+    bb_liberer(M->N);
+    bb_liberer(M->R2);
+    M->N = M->R2 = NULL;
+    M->n = 0;
+}
+
+/**
+ * reduireFinale - r = t - N si t ≥ N, r = t sinon (t : n + 1 mots, t < 2N)
+ */
+static void reduireFinale(uint64_t *r, const uint64_t *t, const uint64_t *N, int n) {
+    int superieur = (t[n] != 0);
+    if (!superieur) {
+        superieur = 1;   // égalité → t - N = 0
+        for (int j = n - 1; j >= 0; --j) {
+            if (t[j] != N[j]) {
+                superieur = (t[j] > N[j]);
+                break;
+            }
+        }
+    }
+    if (superieur) {
+        uint64_t emprunt = 0;
+        for (int j = 0; j < n; ++j) {
+            uint64_t d = t[j] - N[j];
+            uint64_t e1 = (t[j] < N[j]);
+            uint64_t d2 = d - emprunt;
+            emprunt = e1 | (d < emprunt);
+            r[j] = d2;
+        }
+    } else {
+        memcpy(r, t, (size_t)n * sizeof(uint64_t));
+    }
+}
+
+/**
+ * montMulPortable - r = a × b × R^(-1) mod N (méthode CIOS)
+ *
+ * Pour chaque mot b[i] : t += a × b[i], puis t += m × N avec m choisi
+ * pour que le mot bas de t s'annule, et t est décalé d'un mot. Après n
+ * tours t < 2N : une soustraction conditionnelle suffit.
+ */
+static void montMulPortable(const BBMontgomery *M, uint64_t *r, const uint64_t *a,
+                            const uint64_t *b, uint64_t *t) {
+    int n = M->n;
+    const uint64_t *N = M->N;
+    memset(t, 0, (size_t)(n + 2) * sizeof(uint64_t));
+
+    for (int i = 0; i < n; ++i) {
+        // t += a × b[i]
+        uint64_t bi = b[i], c = 0;
+        for (int j = 0; j < n; ++j) {
+            uint64_t hi;
+            uint64_t lo = bb_mul64(a[j], bi, &hi);
+            lo += t[j];
+            hi += (lo < t[j]);
+            lo += c;
+            hi += (lo < c);
+            t[j] = lo;
+            c = hi;
+        }
+        uint64_t s = t[n] + c;
+        t[n + 1] = (s < c);
+        t[n] = s;
+
+        // t = (t + m × N) / 2^64, avec m = t₀ × n0 (t₀ + m N₀ ≡ 0)
+        uint64_t m = t[0] * M->n0, hi;
+        uint64_t lo = bb_mul64(m, N[0], &hi);
+        lo += t[0];
+        c = hi + (lo < t[0]);
+        for (int j = 1; j < n; ++j) {
+            lo = bb_mul64(m, N[j], &hi);
+            lo += t[j];
+            hi += (lo < t[j]);
+            lo += c;
+            hi += (lo < c);
+            t[j - 1] = lo;
+            c = hi;
+        }
+        s = t[n] + c;
+        t[n - 1] = s;
+        t[n] = t[n + 1] + (s < c);
+    }
+
+    reduireFinale(r, t, N, n);
+}
+
+/* ===========================================================
+ *  Noyaux BMI2 / ADX (x86-64)
+ * =========================================================== */
+
+#ifdef BB_NOYAUX_X86
+
+/**
+ * mulAjoutAdx - r[0..n-1] = t[0..n-1] + a[0..n-1] × b + c, retourne le mot de tête
+ *
+ * Ligne de base de tous les noyaux ADX. mulx ne touche pas aux drapeaux,
+ * ce qui permet deux chaînes de retenues entrelacées :
+ *   - CF (adcx) : t[j] + mot bas de a[j] × b ;
+ *   - OF (adox) : + mot haut du produit précédent (c au départ).
+ * Les compteurs avancent avec lea et jrcxz, qui ne modifient pas non plus
+ * les drapeaux. Boucle déroulée par 4, puis les n mod 4 mots restants.
+ *
+ * r peut valoir t ou t - 1 (écriture un mot derrière la lecture).
+ * Les instructions sont en assembleur en ligne : aucune option de
+ * compilation particulière n'est nécessaire, l'appel n'a lieu que si le
+ * CPU les connaît (voir dispoAdx).
+ */
+static uint64_t mulAjoutAdx(uint64_t *r, const uint64_t *t, const uint64_t *a, int n,
+                            uint64_t b, uint64_t c) {
+    uint64_t groupes = (uint64_t)n / 4, restants = (uint64_t)n % 4;
+    uint64_t lo, hi;
+
+#define BB_ADX_MOT(o)                       \
+    "mulx " #o "(%[a]), %[lo], %[hi]\n\t"   \
+    "adcx " #o "(%[t]), %[lo]\n\t"          \
+    "adox %[c], %[lo]\n\t"                  \
+    "mov %[lo], " #o "(%[r])\n\t"           \
+    "mov %[hi], %[c]\n\t"
+
+    __asm__ volatile(
+        "xor %k[lo], %k[lo]\n\t"            // CF = OF = 0
+        "mov %[g], %%rcx\n\t"
+        "jrcxz 2f\n"
+        "1:\n\t"
+        BB_ADX_MOT(0)
+        BB_ADX_MOT(8)
+        BB_ADX_MOT(16)
+        BB_ADX_MOT(24)
+        "lea 32(%[a]), %[a]\n\t"
+        "lea 32(%[t]), %[t]\n\t"
+        "lea 32(%[r]), %[r]\n\t"
+        "lea -1(%%rcx), %%rcx\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n"
+        "2:\n\t"
+        "mov %[m], %%rcx\n\t"
+        "jrcxz 4f\n"
+        "3:\n\t"
+        BB_ADX_MOT(0)
+        "lea 8(%[a]), %[a]\n\t"
+        "lea 8(%[t]), %[t]\n\t"
+        "lea 8(%[r]), %[r]\n\t"
+        "lea -1(%%rcx), %%rcx\n\t"
+        "jrcxz 4f\n\t"
+        "jmp 3b\n"
+        "4:\n\t"
+        "mov $0, %k[lo]\n\t"                // mov : drapeaux intacts
+        "adcx %[lo], %[c]\n\t"
+        "adox %[lo], %[c]\n\t"
+        : [r] "+&r"(r), [t] "+&r"(t), [a] "+&r"(a), [c] "+&r"(c),
+          [lo] "=&r"(lo), [hi] "=&r"(hi)
+        : [g] "r"(groupes), [m] "r"(restants), "d"(b)
+        : "rcx", "cc", "memory");
+
+#undef BB_ADX_MOT
+    return c;
+}
+
+/** mulMotsAdx - r = a × b, une ligne mulAjoutAdx par mot de a */
+static void mulMotsAdx(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb) {
+    memset(r, 0, (size_t)(na + nb) * sizeof(uint64_t));
+    for (int i = 0; i < na; ++i) {
+        if (a[i] == 0) continue;
+        r[i + nb] = mulAjoutAdx(r + i, r + i, b, nb, a[i], 0);
+    }
+}
+
+/** carreMotsAdx - r = a², produits croisés par mulAjoutAdx */
+static void carreMotsAdx(uint64_t *r, const uint64_t *a, int n) {
+    memset(r, 0, (size_t)(2 * n) * sizeof(uint64_t));
+    for (int i = 0; i + 1 < n; ++i)
+        r[i + n] = mulAjoutAdx(r + 2 * i + 1, r + 2 * i + 1, a + i + 1, n - i - 1, a[i], 0);
+    doublerEtDiagonale(r, a, n);
+}
+
+/**
+ * montMulAdx - Même calcul que montMulPortable
+ *
+ * La ligne t += m × N est faite par mulAjoutAdx avec r = t - 1 : le
+ * décalage d'un mot est gratuit. Le mot 0 (qui s'annule) est traité à part.
+ */
+static void montMulAdx(const BBMontgomery *M, uint64_t *r, const uint64_t *a,
+                       const uint64_t *b, uint64_t *t) {
+    int n = M->n;
+    const uint64_t *N = M->N;
+    memset(t, 0, (size_t)(n + 2) * sizeof(uint64_t));
+
+    for (int i = 0; i < n; ++i) {
+        uint64_t c = mulAjoutAdx(t, t, a, n, b[i], 0);
+        uint64_t s = t[n] + c;
+        t[n + 1] = (s < c);
+        t[n] = s;
+
+        uint64_t m = t[0] * M->n0, hi;
+        uint64_t lo = bb_mul64(m, N[0], &hi);
+        lo += t[0];
+        c = mulAjoutAdx(t, t + 1, N + 1, n - 1, m, hi + (lo < t[0]));
+        s = t[n] + c;
+        t[n - 1] = s;
+        t[n] = t[n + 1] + (s < c);
+    }
+
+    reduireFinale(r, t, N, n);
+}
+
+/* BMI2 (mulx) et ADX (adcx/adox) : CPUID feuille 7, registre EBX */
+static int dispoAdx(void) {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return 0;
+    return (ebx & bit_BMI2) && (ebx & bit_ADX);
+}
+
+#endif /* BB_NOYAUX_X86 */
+
+/* ===========================================================
+ *  Choix des noyaux
+ * =========================================================== */
+
+typedef struct {
+    const char *nom;
+    void (*mulMots)(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb);
+    void (*carreMots)(uint64_t *r, const uint64_t *a, int n);
+    void (*montMul)(const BBMontgomery *M, uint64_t *r, const uint64_t *a,
+                    const uint64_t *b, uint64_t *t);
+    int (*disponible)(void);
+} NoyauxMots;
+
+static int dispoPortable(void) {
+    return 1;
+}
+
+/* Du plus rapide au plus lent : le premier disponible est retenu */
+static const NoyauxMots NOYAUX[] = {
+#ifdef BB_NOYAUX_X86
+    { "bmi2-adx", mulMotsAdx, carreMotsAdx, montMulAdx, dispoAdx },
+#endif
+    { "portable", mulMotsPortable, carreMotsPortable, montMulPortable, dispoPortable },
+};
+
+#define NB_NOYAUX ((int)(sizeof(NOYAUX) / sizeof(NOYAUX[0])))
+
+static const NoyauxMots *noyauxActifs = NULL;
+static pthread_once_t noyauxUneFois = PTHREAD_ONCE_INIT;
+
+static void detecterNoyaux(void) {
+    for (int i = 0; i < NB_NOYAUX; ++i) {
+        if (NOYAUX[i].disponible()) {
+            noyauxActifs = &NOYAUX[i];
+            return;
+        }
+    }
+}
+
+static const NoyauxMots *noyaux(void) {
+    pthread_once(&noyauxUneFois, detecterNoyaux);
+    return noyauxActifs;
+}
+
+const char *BigBinary_noyaux(void) {
+    return noyaux()->nom;
+}
+
+int BigBinary_choisirNoyaux(const char *nom) {
+    noyaux();   // détection faite avant de la remplacer
+    for (int i = 0; i < NB_NOYAUX; ++i) {
+        if (strcmp(NOYAUX[i].nom, nom) == 0 && NOYAUX[i].disponible()) {
+            noyauxActifs = &NOYAUX[i];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void bb_mulMots(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb) {
+    noyaux()->mulMots(r, a, na, b, nb);
+}
+
+void bb_carreMots(uint64_t *r, const uint64_t *a, int n) {
+    noyaux()->carreMots(r, a, n);
+}
+
+void bb_montMul(const BBMontgomery *M, uint64_t *r, const uint64_t *a, const uint64_t *b,
+                uint64_t *t) {
+    noyaux()->montMul(M, r, a, b, t);
+}
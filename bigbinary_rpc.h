@@ -0,0 +1,61 @@
+#ifndef BIGBINARY_RPC_H
+#define BIGBINARY_RPC_H
+
+/*
+ * ============================================================================
+ * PROTOCOLE DU SERVEUR BIGBINARY (socket Unix, flux d'octets)
+ * ============================================================================
+ *
+ * Chaque message est préfixé par sa longueur ; tous les entiers sont
+ * gros-boutistes (comme l'en-tête de rsa_flux) :
+ *
+ *   REQUÊTE                               RÉPONSE
+ *   u32 longueur (de ce qui suit)         u32 longueur (de ce qui suit)
+ *   u32 id       (choisi par le client)   u32 id       (celui de la requête)
+ *   u8  operation                         u8  statut   (RPC_OK, RPC_ERR_…)
+ *   u32 cle      (RSA : id de la clé)     u32 lg + lg octets : résultat
+ *   u8  nb opérandes                          (gros-boutiste, lg = 0 si erreur)
+ *   nb × (u32 lg + lg octets)
+ *
+ *   RPC_EXPMOD   M E N   → M^E mod N
+ *   RPC_RSA_ENC  M       → M^e mod n   (clé "cle" du serveur)
+ *   RPC_RSA_DEC  C       → C^d mod n
+ *   RPC_GCD      A B     → pgcd(A, B)
+ *
+ * Une connexion peut envoyer plusieurs requêtes sans attendre : les
+ * réponses arrivent dans l'ordre où elles sont prêtes, l'id les relie.
+ * ============================================================================
+ */
+
+#include <stdint.h>
+
+#define RPC_MESSAGE_MAX   (1u << 20)   // au-delà, la connexion est fermée
+#define RPC_OPERANDES_MAX 3
+
+enum {
+    RPC_EXPMOD  = 1,
+    RPC_RSA_ENC = 2,
+    RPC_RSA_DEC = 3,
+    RPC_GCD     = 4
+};
+
+enum {
+    RPC_OK              = 0,
+    RPC_ERR_REQUETE     = 1,   // opération ou opérandes invalides
+    RPC_ERR_CLE         = 2,   // clé inconnue (ou sans exposant privé)
+    RPC_ERR_DOMAINE     = 3    // module nul, message ≥ module
+};
+
+static inline void rpc_ecrireU32(unsigned char *p, uint32_t v) {
+    p[0] = (unsigned char)(v >> 24);
+    p[1] = (unsigned char)(v >> 16);
+    p[2] = (unsigned char)(v >> 8);
+    p[3] = (unsigned char)v;
+}
+
+static inline uint32_t rpc_lireU32(const unsigned char *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+         | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+#endif
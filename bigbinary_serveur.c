@@ -0,0 +1,721 @@
+/*
+ * ============================================================================
+ * BIGBINARY_SERVEUR : LA BIBLIOTHÈQUE COMME SERVICE LOCAL (SOCKET UNIX)
+ * ============================================================================
+ *
+ * Lancer projet_C pour chaque opération refait tout à chaque fois : le
+ * cache des modules, les tables, les arènes repartent de zéro. Ici un
+ * processus de longue durée garde ses clés et ses contextes chauds et
+ * répond aux requêtes de bigbinary_rpc.h sur une socket Unix.
+ *
+ *   boucle epoll (1 thread)   : accepte, lit, découpe les messages,
+ *                               envoie les réponses prêtes
+ *   travailleurs (N threads)  : calculent, par lots
+ *
+ * REGROUPEMENT PAR CLÉ : un travailleur qui prend une requête RSA emporte
+ * aussi les requêtes en attente pour la même clé et la même opération
+ * (LOT_MAX au plus) et les calcule ensemble avec BigBinary_expModLot :
+ * même exposant, même module, une voie SIMD par message. Plus il y a de
+ * clients concurrents, plus les lots sont pleins.
+ *
+ * Les travailleurs n'écrivent jamais sur les sockets : ils ajoutent la
+ * réponse au tampon de sortie de la connexion et réveillent la boucle
+ * par un eventfd. Une connexion est comptée (boucle + requêtes en cours
+ * + liste des sorties à vider + lot d'événements epoll en cours) : fermée
+ * par le client pendant un calcul, ou par la boucle au milieu d'un lot
+ * d'événements, elle n'est libérée qu'à la dernière référence. Un client
+ * qui ferme seulement son sens d'écriture (shutdown) reçoit encore toutes
+ * ses réponses avant la fermeture.
+ *
+ * CONTRE-PRESSION : au-delà de EN_COURS_MAX requêtes en vol ou de
+ * SORTIE_MAX octets de réponses non envoyées, la boucle cesse de lire la
+ * connexion (plus d'EPOLLIN) et la reprend quand elle s'est vidée. Un
+ * client qui envoie sans lire ses réponses ne fait donc pas grossir la
+ * mémoire du serveur : il est bloqué par sa propre socket.
+ *
+ * FICHIER DE CLÉS (-k) : une clé par ligne, "id n e [d]", opérandes en
+ * binaire ou en hexadécimal (0x…), lignes # ignorées. Sans d, la clé ne
+ * sert qu'au chiffrement.
+ *
+ * UTILISATION :
+ *   bigbinary_serveur -s chemin [-k cles] [-t threads]
+ * Arrêt par SIGINT / SIGTERM (statistiques des lots sur stderr).
+ * ============================================================================
+ */
+
+#define _GNU_SOURCE   // accept4
+#include "bigbinary.h"
+#include "bigbinary_rpc.h"
+#include "commandes_lot.h"
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define LOT_MAX          16      // requêtes d'une même clé calculées ensemble
+#define EVENEMENTS_MAX   64
+#define LECTURE          65536   // octets lus par appel
+#define EN_COURS_MAX     256     // requêtes en vol par connexion avant de cesser de la lire
+#define SORTIE_MAX       (1u << 20)   // octets de réponses en attente, idem
+
+/* Tampon d'octets extensible */
+typedef struct {
+    unsigned char *d;
+    size_t lg, cap;
+} Octets;
+
+typedef struct Connexion {
+    int fd;
+    int references;              // boucle epoll + requêtes en cours + liste à vider
+                                 // + lot d'événements en cours de traitement
+    int fermee;
+    int finLue;                  // le client a fini d'écrire (demi-fermeture)
+    int enCours;                 // requêtes en file ou en calcul
+    int aVider;                  // déjà dans la liste des sorties à envoyer
+    uint32_t masque;             // événements epoll demandés
+    Octets entree;               // reçu, pas encore découpé (boucle seule)
+    Octets sortie;               // réponses à envoyer (verrou)
+    size_t envoye;               // partie de sortie déjà envoyée
+    struct Connexion *suivanteAVider;
+    struct Connexion *prec, *suiv;   // connexions ouvertes
+} Connexion;
+
+typedef struct Requete {
+    Connexion *cx;
+    uint32_t id, cle;
+    int op, nb;
+    BigBinary X[RPC_OPERANDES_MAX];
+    struct Requete *suivante;
+} Requete;
+
+typedef struct {
+    uint32_t id;
+    BigBinary n, e, d;
+    int prive;                   // d présent
+} Cle;
+
+typedef struct {
+    // Clés (lecture seule après le démarrage)
+    Cle *cles;
+    int nbCles;
+
+    int epfd, evfd, ecoute;
+
+    // Tout ce qui suit est protégé par verrou
+    pthread_mutex_t verrou;
+    pthread_cond_t condTravail;      // une requête est en file
+    Requete *tete, *queue;           // file FIFO
+    Connexion *aVider;               // connexions ayant des réponses à envoyer
+    Connexion *ouvertes;
+    int arret;
+
+    // Statistiques
+    unsigned long long nbRequetes, nbLots;
+} Serveur;
+
+static volatile sig_atomic_t signalRecu = 0;
+
+static void surSignal(int sig) {
+    (void)sig;
+    signalRecu = 1;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "Usage : %s -s chemin [-k cles] [-t threads]\n", prog);
+}
+
+/* ===========================================================
+ *  Tampons, clés, connexions
+ * =========================================================== */
+
+static void reserver(Octets *t, size_t n) {
+    if (t->lg + n <= t->cap) return;
+    size_t cap = t->cap ? t->cap : 256;
+    while (cap < t->lg + n) cap *= 2;
+    t->d = (unsigned char*)realloc(t->d, cap);
+    t->cap = cap;
+}
+
+static const Cle *chercherCle(const Serveur *S, uint32_t id) {
+    for (int i = 0; i < S->nbCles; ++i)
+        if (S->cles[i].id == id) return &S->cles[i];
+    return NULL;
+}
+
+/* Lit le fichier de clés ; 0 si une ligne est invalide */
+static int chargerCles(Serveur *S, const char *nom) {
+    FILE *f = fopen(nom, "r");
+    if (f == NULL) {
+        fprintf(stderr, "Erreur: impossible d'ouvrir %s\n", nom);
+        return 0;
+    }
+    char *ligne = NULL;
+    size_t cap = 0;
+    long numero = 0;
+    int ok = 1;
+    while (ok && getline(&ligne, &cap, f) >= 0) {
+        numero++;
+        char *suite = NULL;
+        const char *SEP = " \t\r\n";
+        char *jetons[4];
+        int n = 0;
+        for (char *j = strtok_r(ligne, SEP, &suite); j != NULL && n < 4; j = strtok_r(NULL, SEP, &suite))
+            jetons[n++] = j;
+        if (n == 0 || jetons[0][0] == '#') continue;
+
+        Cle c;
+        memset(&c, 0, sizeof(c));
+        char *fin;
+        c.id = (uint32_t)strtoul(jetons[0], &fin, 10);
+        c.prive = (n == 4);
+        int lus = 0;
+        if (n >= 3 && *fin == '\0' && lireOperande(jetons[1], &c.n) && ++lus
+            && lireOperande(jetons[2], &c.e) && ++lus
+            && (!c.prive || (lireOperande(jetons[3], &c.d) && ++lus))
+            && !estZero(c.n) && chercherCle(S, c.id) == NULL) {
+            S->cles = (Cle*)realloc(S->cles, (size_t)(S->nbCles + 1) * sizeof(Cle));
+            S->cles[S->nbCles++] = c;
+        } else {
+            fprintf(stderr, "Erreur: cle invalide ou en double, %s ligne %ld\n", nom, numero);
+            if (lus > 0) libereBigBinary(&c.n);
+            if (lus > 1) libereBigBinary(&c.e);
+            if (lus > 2) libereBigBinary(&c.d);
+            ok = 0;
+        }
+    }
+    free(ligne);
+    fclose(f);
+    return ok;
+}
+
+/* Rend une référence (verrou tenu) ; la dernière libère la connexion */
+static void relacher(Connexion *cx) {
+    if (--cx->references > 0) return;
+    free(cx->entree.d);
+    free(cx->sortie.d);
+    free(cx);
+}
+
+/* Ajoute la connexion à la liste des sorties à vider (verrou tenu) */
+static void marquerAVider(Serveur *S, Connexion *cx) {
+    if (cx->aVider) return;
+    cx->aVider = 1;
+    cx->references++;
+    cx->suivanteAVider = S->aVider;
+    S->aVider = cx;
+}
+
+/* Ajoute une réponse au tampon de sortie (verrou tenu) */
+static void repondre(Serveur *S, Connexion *cx, uint32_t id, int statut, const BigBinary *R) {
+    if (cx->fermee) return;
+    size_t lg = (statut == RPC_OK) ? ((size_t)BigBinary_nbBits(*R) + 7) / 8 : 0;
+    reserver(&cx->sortie, 4 + 9 + lg);
+    unsigned char *p = cx->sortie.d + cx->sortie.lg;
+    rpc_ecrireU32(p, (uint32_t)(9 + lg));
+    rpc_ecrireU32(p + 4, id);
+    p[8] = (unsigned char)statut;
+    rpc_ecrireU32(p + 9, (uint32_t)lg);
+    if (lg > 0) BigBinary_toBytes(*R, p + 13, lg);
+    cx->sortie.lg += 4 + 9 + lg;
+    marquerAVider(S, cx);
+}
+
+/* ===========================================================
+ *  TRAVAILLEURS
+ * =========================================================== */
+
+/**
+ * calculerLot - Calcule k requêtes de même opération (et même clé si RSA)
+ *
+ * CAS 1 : RSA → messages valides regroupés, un seul BigBinary_expModLot
+ * CAS 2 : expmod, gcd → une requête à la fois (k = 1)
+ */
+static void calculerLot(const Serveur *S, Requete **lot, int k, BigBinary *res, int *statut) {
+    for (int i = 0; i < k; ++i) {
+        res[i] = initBigBinary();
+        statut[i] = RPC_OK;
+    }
+    Requete *r = lot[0];
+
+    if (r->op == RPC_EXPMOD) {
+        if (estZero(r->X[2])) statut[0] = RPC_ERR_DOMAINE;
+        else res[0] = BigBinary_expMod(r->X[0], r->X[1], r->X[2]);
+        return;
+    }
+    if (r->op == RPC_GCD) {
+        res[0] = pgcdBinaire(r->X[0], r->X[1]);
+        return;
+    }
+
+    // CAS 1 : RSA, même clé pour tout le lot
+    const Cle *c = chercherCle(S, r->cle);
+    if (c == NULL || (r->op == RPC_RSA_DEC && !c->prive)) {
+        for (int i = 0; i < k; ++i) statut[i] = RPC_ERR_CLE;
+        return;
+    }
+    BigBinary messages[LOT_MAX], sorties[LOT_MAX];
+    int place[LOT_MAX], nb = 0;
+    for (int i = 0; i < k; ++i) {
+        if (BigBinary_cmp(lot[i]->X[0], c->n) >= 0) {
+            statut[i] = RPC_ERR_DOMAINE;
+            continue;
+        }
+        messages[nb] = lot[i]->X[0];
+        place[nb++] = i;
+    }
+    BigBinary_expModLot(messages, sorties, nb, r->op == RPC_RSA_ENC ? c->e : c->d, c->n);
+    for (int j = 0; j < nb; ++j) res[place[j]] = sorties[j];
+}
+
+/* Retire de la file la tête et, si RSA, les requêtes de même clé (verrou tenu) */
+static int prendreLot(Serveur *S, Requete **lot) {
+    Requete *r = S->tete;
+    S->tete = r->suivante;
+    if (S->tete == NULL) S->queue = NULL;
+    lot[0] = r;
+    int k = 1;
+    if (r->op != RPC_RSA_ENC && r->op != RPC_RSA_DEC) return k;
+
+    Requete *prec = NULL;
+    for (Requete *q = S->tete; q != NULL && k < LOT_MAX; ) {
+        Requete *suiv = q->suivante;
+        if (q->op == r->op && q->cle == r->cle) {
+            if (prec) prec->suivante = suiv;
+            else S->tete = suiv;
+            if (S->queue == q) S->queue = prec;
+            lot[k++] = q;
+        } else {
+            prec = q;
+        }
+        q = suiv;
+    }
+    return k;
+}
+
+static void libererRequete(Requete *r) {
+    for (int i = 0; i < r->nb; ++i) libereBigBinary(&r->X[i]);
+    free(r);
+}
+
+static void *travailleur(void *arg) {
+    Serveur *S = (Serveur*)arg;
+    Requete *lot[LOT_MAX];
+    BigBinary res[LOT_MAX];
+    int statut[LOT_MAX];
+
+    pthread_mutex_lock(&S->verrou);
+    for (;;) {
+        while (!S->arret && S->tete == NULL)
+            pthread_cond_wait(&S->condTravail, &S->verrou);
+        if (S->arret) break;
+
+        int k = prendreLot(S, lot);
+        S->nbRequetes += (unsigned long long)k;
+        S->nbLots++;
+        pthread_mutex_unlock(&S->verrou);
+
+        calculerLot(S, lot, k, res, statut);
+
+        pthread_mutex_lock(&S->verrou);
+        for (int i = 0; i < k; ++i) {
+            repondre(S, lot[i]->cx, lot[i]->id, statut[i], &res[i]);
+            lot[i]->cx->enCours--;
+            marquerAVider(S, lot[i]->cx);   // même sans réponse : la fin est peut-être là
+            relacher(lot[i]->cx);
+        }
+        pthread_mutex_unlock(&S->verrou);
+
+        for (int i = 0; i < k; ++i) {
+            libereBigBinary(&res[i]);
+            libererRequete(lot[i]);
+        }
+        uint64_t un = 1;
+        if (write(S->evfd, &un, sizeof(un)) < 0) { /* compteur saturé : la boucle est déjà réveillée */ }
+        pthread_mutex_lock(&S->verrou);
+    }
+    pthread_mutex_unlock(&S->verrou);
+    return NULL;
+}
+
+/* ===========================================================
+ *  BOUCLE EPOLL
+ * =========================================================== */
+
+/* Trop de travail en attente pour cette connexion : cesser de la lire (verrou tenu) */
+static int saturee(const Connexion *cx) {
+    return cx->enCours >= EN_COURS_MAX || cx->sortie.lg - cx->envoye >= SORTIE_MAX;
+}
+
+/* Événements epoll voulus (verrou tenu) */
+static void surveiller(Serveur *S, Connexion *cx, uint32_t masque) {
+    if (masque == cx->masque) return;
+    struct epoll_event ev;
+    ev.events = masque;
+    ev.data.ptr = cx;
+    epoll_ctl(S->epfd, EPOLL_CTL_MOD, cx->fd, &ev);
+    cx->masque = masque;
+}
+
+/* Ferme la socket et rend la référence de la boucle (verrou tenu) */
+static void fermer(Serveur *S, Connexion *cx) {
+    if (cx->fermee) return;
+    epoll_ctl(S->epfd, EPOLL_CTL_DEL, cx->fd, NULL);
+    close(cx->fd);
+    cx->fermee = 1;
+    if (cx->prec) cx->prec->suiv = cx->suiv;
+    else S->ouvertes = cx->suiv;
+    if (cx->suiv) cx->suiv->prec = cx->prec;
+    relacher(cx);
+}
+
+/* Envoie ce qui peut l'être sans bloquer (verrou tenu) ; EPOLLOUT si reste */
+static void envoyer(Serveur *S, Connexion *cx) {
+    Octets *o = &cx->sortie;
+    while (cx->envoye < o->lg) {
+        ssize_t n = send(cx->fd, o->d + cx->envoye, o->lg - cx->envoye, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n > 0) {
+            cx->envoye += (size_t)n;
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            fermer(S, cx);   // client parti
+            return;
+        }
+    }
+
+    int reste = cx->envoye < o->lg;
+    if (!reste) o->lg = cx->envoye = 0;
+
+    // Demi-fermeture : plus rien à lire, fermer quand tout est répondu
+    if (cx->finLue && !reste && cx->enCours == 0) fermer(S, cx);
+    else surveiller(S, cx, (cx->finLue || saturee(cx) ? 0 : EPOLLIN) | (reste ? EPOLLOUT : 0));
+}
+
+/* Envoie les réponses de toutes les connexions marquées (verrou tenu) */
+static void viderSorties(Serveur *S) {
+    Connexion *cx = S->aVider;
+    S->aVider = NULL;
+    while (cx != NULL) {
+        Connexion *suiv = cx->suivanteAVider;
+        cx->aVider = 0;
+        if (!cx->fermee) envoyer(S, cx);
+        relacher(cx);
+        cx = suiv;
+    }
+}
+
+static void accepter(Serveur *S) {
+    for (;;) {
+        int fd = accept4(S->ecoute, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) return;   // EAGAIN : plus personne en attente
+
+        Connexion *cx = (Connexion*)calloc(1, sizeof(Connexion));
+        cx->fd = fd;
+        cx->references = 1;
+        cx->masque = EPOLLIN;
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = cx;
+        epoll_ctl(S->epfd, EPOLL_CTL_ADD, fd, &ev);
+
+        pthread_mutex_lock(&S->verrou);
+        cx->suiv = S->ouvertes;
+        if (S->ouvertes) S->ouvertes->prec = cx;
+        S->ouvertes = cx;
+        pthread_mutex_unlock(&S->verrou);
+    }
+}
+
+/**
+ * decoder - Transforme un message complet en requête
+ *
+ * Message mal formé ou opérandes en nombre inattendu : réponse
+ * RPC_ERR_REQUETE tout de suite, sans passer par les travailleurs.
+ */
+static void decoder(Serveur *S, Connexion *cx, const unsigned char *m, uint32_t lg) {
+    static const int OPERANDES[] = { 0, 3, 1, 1, 2 };   // par opération
+
+    uint32_t id = (lg >= 4) ? rpc_lireU32(m) : 0;
+    int valide = (lg >= 10);
+    Requete *r = NULL;
+    if (valide) {
+        r = (Requete*)calloc(1, sizeof(Requete));
+        r->cx = cx;
+        r->id = id;
+        r->op = m[4];
+        r->cle = rpc_lireU32(m + 5);
+        int nb = m[9];
+        valide = r->op >= RPC_EXPMOD && r->op <= RPC_GCD && nb == OPERANDES[r->op];
+
+        size_t pos = 10;
+        while (valide && r->nb < nb) {
+            if (lg - pos < 4 || lg - pos - 4 < rpc_lireU32(m + pos)) {
+                valide = 0;
+                break;
+            }
+            uint32_t l = rpc_lireU32(m + pos);
+            r->X[r->nb++] = initBigBinaryFromBytes(m + pos + 4, l);
+            pos += 4 + l;
+        }
+        if (pos != lg) valide = 0;
+    }
+
+    pthread_mutex_lock(&S->verrou);
+    if (valide) {
+        cx->references++;
+        cx->enCours++;
+        if (S->queue) S->queue->suivante = r;
+        else S->tete = r;
+        S->queue = r;
+        pthread_cond_signal(&S->condTravail);
+    } else {
+        repondre(S, cx, id, RPC_ERR_REQUETE, NULL);
+    }
+    pthread_mutex_unlock(&S->verrou);
+    if (!valide && r != NULL) libererRequete(r);
+}
+
+/* Découpe les messages complets reçus ; 0 si le flux est désynchronisé */
+static int decouper(Serveur *S, Connexion *cx) {
+    Octets *e = &cx->entree;
+    size_t pos = 0;
+    int ok = 1;
+    while (e->lg - pos >= 4) {
+        uint32_t lg = rpc_lireU32(e->d + pos);
+        if (lg > RPC_MESSAGE_MAX) {   // flux désynchronisé ou hostile
+            ok = 0;
+            break;
+        }
+        if (e->lg - pos - 4 < lg) break;
+        decoder(S, cx, e->d + pos + 4, lg);
+        pos += 4 + (size_t)lg;
+    }
+    memmove(e->d, e->d + pos, e->lg - pos);
+    e->lg -= pos;
+    return ok;
+}
+
+/**
+ * lire - Lit ce qui est disponible et découpe les messages au fil de l'eau
+ *
+ * S'arrête à la fin du flux, sur EAGAIN, ou dès que la connexion est
+ * saturée : le reste attend dans la socket que les réponses partent.
+ * L'entrée ne garde ainsi qu'un message incomplet et une lecture.
+ */
+static void lire(Serveur *S, Connexion *cx) {
+    Octets *e = &cx->entree;
+    int fin = 0, erreur = 0, pleine = 0;
+    while (!fin && !erreur && !pleine) {
+        reserver(e, LECTURE);
+        ssize_t n = read(cx->fd, e->d + e->lg, LECTURE);
+        if (n > 0) {
+            e->lg += (size_t)n;
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else {
+            fin = (n == 0);
+            erreur = (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK);
+            break;
+        }
+
+        if (!decouper(S, cx)) erreur = 1;
+        pthread_mutex_lock(&S->verrou);
+        pleine = saturee(cx);
+        pthread_mutex_unlock(&S->verrou);
+    }
+
+    // Réponses d'erreur immédiates ; en fin de flux, la fermeture attend les
+    // calculs. envoyer recalcule aussi le masque epoll (saturation, fin).
+    pthread_mutex_lock(&S->verrou);
+    if (erreur) {
+        fermer(S, cx);
+    } else {
+        if (fin) cx->finLue = 1;
+        marquerAVider(S, cx);
+    }
+    viderSorties(S);
+    pthread_mutex_unlock(&S->verrou);
+}
+
+static int ouvrirEcoute(const char *chemin) {
+    struct sockaddr_un adr;
+    memset(&adr, 0, sizeof(adr));
+    adr.sun_family = AF_UNIX;
+    if (strlen(chemin) >= sizeof(adr.sun_path)) {
+        fprintf(stderr, "Erreur: chemin de socket trop long\n");
+        return -1;
+    }
+    strcpy(adr.sun_path, chemin);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    unlink(chemin);   // socket laissée par une instance précédente
+    if (fd < 0 || bind(fd, (struct sockaddr*)&adr, sizeof(adr)) < 0 || listen(fd, 128) < 0) {
+        fprintf(stderr, "Erreur: impossible d'ecouter sur %s (%s)\n", chemin, strerror(errno));
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/* ============================================================================
+ * PROGRAMME PRINCIPAL
+ * ============================================================================ */
+
+int main(int argc, char **argv) {
+    const char *chemin = NULL, *nomCles = NULL;
+    long nbTravailleurs = sysconf(_SC_NPROCESSORS_ONLN);
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        if (strcmp(argv[i], "-s") == 0) chemin = argv[++i];
+        else if (strcmp(argv[i], "-k") == 0) nomCles = argv[++i];
+        else if (strcmp(argv[i], "-t") == 0) nbTravailleurs = atol(argv[++i]);
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (chemin == NULL) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (nbTravailleurs < 1) nbTravailleurs = 1;
+
+    Serveur S;
+    memset(&S, 0, sizeof(S));
+    if (nomCles != NULL && !chargerCles(&S, nomCles)) return 1;
+    S.ecoute = ouvrirEcoute(chemin);
+    if (S.ecoute < 0) return 1;
+    S.epfd = epoll_create1(EPOLL_CLOEXEC);
+    S.evfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    pthread_mutex_init(&S.verrou, NULL);
+    pthread_cond_init(&S.condTravail, NULL);
+
+    // Deux marqueurs distinguent la socket d'écoute et l'eventfd des connexions
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = &S.ecoute;
+    epoll_ctl(S.epfd, EPOLL_CTL_ADD, S.ecoute, &ev);
+    ev.data.ptr = &S.evfd;
+    epoll_ctl(S.epfd, EPOLL_CTL_ADD, S.evfd, &ev);
+
+    // Signaux : bloqués partout, boucle comprise ; seul epoll_pwait les
+    // débloque (attente), de façon atomique. Un signal arrivé entre le test
+    // de signalRecu et l'attente reste en suspens et l'interrompt aussitôt.
+    sigset_t arret, prec, attente;
+    sigemptyset(&arret);
+    sigaddset(&arret, SIGINT);
+    sigaddset(&arret, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &arret, &prec);
+    attente = prec;
+    sigdelset(&attente, SIGINT);
+    sigdelset(&attente, SIGTERM);
+    pthread_t *th = (pthread_t*)malloc((size_t)nbTravailleurs * sizeof(pthread_t));
+    for (long i = 0; i < nbTravailleurs; ++i) pthread_create(&th[i], NULL, travailleur, &S);
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = surSignal;   // sans SA_RESTART : epoll_pwait est interrompu
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    fprintf(stderr, "bigbinary_serveur : %s, %d cle(s), %ld travailleur(s), moteur %s\n",
+            chemin, S.nbCles, nbTravailleurs, BigBinary_moteurLot());
+
+    struct epoll_event evs[EVENEMENTS_MAX];
+    while (!signalRecu) {
+        int n = epoll_pwait(S.epfd, evs, EVENEMENTS_MAX, -1, &attente);
+
+        // Une référence par connexion du lot d'événements : une action sur
+        // l'une (envoi en échec, fermeture) peut en fermer une autre dont
+        // l'événement suit ; elle reste valide jusqu'à la fin du lot
+        pthread_mutex_lock(&S.verrou);
+        for (int i = 0; i < n; ++i)
+            if (evs[i].data.ptr != &S.ecoute && evs[i].data.ptr != &S.evfd)
+                ((Connexion*)evs[i].data.ptr)->references++;
+        pthread_mutex_unlock(&S.verrou);
+
+        for (int i = 0; i < n; ++i) {
+            void *p = evs[i].data.ptr;
+            if (p == &S.ecoute) {
+                accepter(&S);
+            } else if (p == &S.evfd) {
+                uint64_t v;
+                if (read(S.evfd, &v, sizeof(v)) < 0) { /* déjà remis à zéro */ }
+                pthread_mutex_lock(&S.verrou);
+                viderSorties(&S);
+                pthread_mutex_unlock(&S.verrou);
+            } else {
+                // Fermée plus tôt dans ce lot : son descripteur est peut-être déjà réutilisé
+                Connexion *cx = (Connexion*)p;
+                if (cx->fermee) continue;
+                uint32_t e = evs[i].events;
+                if (e & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                    if (e & (EPOLLHUP | EPOLLERR)) {   // plus personne pour lire les réponses
+                        pthread_mutex_lock(&S.verrou);
+                        fermer(&S, cx);
+                        pthread_mutex_unlock(&S.verrou);
+                    } else {
+                        lire(&S, cx);
+                    }
+                } else if (e & EPOLLOUT) {
+                    pthread_mutex_lock(&S.verrou);
+                    envoyer(&S, cx);
+                    pthread_mutex_unlock(&S.verrou);
+                }
+            }
+        }
+
+        pthread_mutex_lock(&S.verrou);
+        for (int i = 0; i < n; ++i)
+            if (evs[i].data.ptr != &S.ecoute && evs[i].data.ptr != &S.evfd)
+                relacher((Connexion*)evs[i].data.ptr);
+        pthread_mutex_unlock(&S.verrou);
+    }
+
+    // Arrêt : travailleurs d'abord, puis requêtes restantes et connexions
+    pthread_mutex_lock(&S.verrou);
+    S.arret = 1;
+    pthread_cond_broadcast(&S.condTravail);
+    pthread_mutex_unlock(&S.verrou);
+    for (long i = 0; i < nbTravailleurs; ++i) pthread_join(th[i], NULL);
+    free(th);
+
+    while (S.tete != NULL) {
+        Requete *r = S.tete;
+        S.tete = r->suivante;
+        relacher(r->cx);
+        libererRequete(r);
+    }
+    viderSorties(&S);
+    while (S.ouvertes != NULL) fermer(&S, S.ouvertes);
+    viderSorties(&S);
+
+    fprintf(stderr, "bigbinary_serveur : %llu requete(s), %llu lot(s), %.2f requete(s) par lot\n",
+            S.nbRequetes, S.nbLots, S.nbLots ? (double)S.nbRequetes / (double)S.nbLots : 0.0);
+
+    for (int i = 0; i < S.nbCles; ++i) {
+        libereBigBinary(&S.cles[i].n);
+        libereBigBinary(&S.cles[i].e);
+        if (S.cles[i].prive) libereBigBinary(&S.cles[i].d);
+    }
+    free(S.cles);
+    close(S.evfd);
+    close(S.epfd);
+    close(S.ecoute);
+    unlink(chemin);
+    pthread_mutex_destroy(&S.verrou);
+    pthread_cond_destroy(&S.condTravail);
+    return 0;
+}
@@ -0,0 +1,253 @@
+#include "bigbinary_interne.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * ============================================================================
+ * COMPTEURS D'OPÉRATIONS (instrumentation optionnelle)
+ * ============================================================================
+ *
+ * Compilé avec BIGBINARY_INSTRUMENTATION (option CMake du même nom), chaque
+ * primitive ajoute à des compteurs propres au thread : nombre d'appels,
+ * mots traités et cycles cumulés. Les allocations de tableaux sont comptées
+ * dans bb_allouer().
+ *
+ * Les compteurs de chaque thread sont chaînés dans une liste globale pour
+ * que BigBinaryStats_total() puisse les additionner ; à la fin d'un thread,
+ * ses compteurs sont versés dans un total "threads terminés".
+ *
+ * Sans l'option, les macros BB_STAT_* ne génèrent aucun code et l'API
+ * ci-dessous renvoie des compteurs à zéro.
+ * ============================================================================
+ */
+
+static const char *NOMS_PRIMITIVES[BB_NB_PRIMITIVES] = {
+    "add", "sub", "cmp", "mod", "mul_mod", "decalage", "normalise", "pgcd", "expmod"
+};
+
+const char *BigBinaryStats_nom(BigBinaryPrimitive p) {
+    if ((int)p < 0 || p >= BB_NB_PRIMITIVES) return "?";
+    return NOMS_PRIMITIVES[p];
+}
+
+void BigBinaryStats_afficher(FILE *f, const BigBinaryStats *s) {
+    if (f == NULL || s == NULL) return;
+    fprintf(f, "%-10s %14s %16s %18s\n", "primitive", "appels", "mots", "cycles");
+    for (int i = 0; i < BB_NB_PRIMITIVES; ++i) {
+        const BigBinaryCompteur *c = &s->prim[i];
+        if (c->appels == 0) continue;
+        fprintf(f, "%-10s %14llu %16llu %18llu\n", NOMS_PRIMITIVES[i],
+                c->appels, c->mots, c->cycles);
+    }
+    fprintf(f, "allocations : %llu (dont %llu sur le tas), %llu octets\n",
+            s->allocations, s->allocationsTas, s->octetsAlloues);
+}
+
+#ifdef BIGBINARY_INSTRUMENTATION
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+/* Additionne b dans a */
+static void cumuler(BigBinaryStats *a, const BigBinaryStats *b) {
+    for (int i = 0; i < BB_NB_PRIMITIVES; ++i) {
+        a->prim[i].appels += b->prim[i].appels;
+        a->prim[i].mots   += b->prim[i].mots;
+        a->prim[i].cycles += b->prim[i].cycles;
+    }
+    a->allocations    += b->allocations;
+    a->allocationsTas += b->allocationsTas;
+    a->octetsAlloues  += b->octetsAlloues;
+}
+
+/*
+ * Compteurs d'un thread, chaînés dans la liste globale
+ *
+ * Seul le thread propriétaire les modifie, les autres les lisent (total) :
+ * des atomiques en ordre relâché suffisent, et comme il n'y a qu'un seul
+ * écrivain, chaque incrément est une lecture puis une écriture ordinaires
+ * (pas d'instruction verrouillée sur le chemin chaud). La remise à zéro
+ * n'écrit pas dans ces compteurs : elle mémorise leur valeur dans "base",
+ * que les lectures soustraient.
+ */
+typedef unsigned long long CompteurAtomique;
+
+typedef struct StatsThread {
+    _Atomic CompteurAtomique appels[BB_NB_PRIMITIVES];
+    _Atomic CompteurAtomique mots[BB_NB_PRIMITIVES];
+    _Atomic CompteurAtomique cycles[BB_NB_PRIMITIVES];
+    _Atomic CompteurAtomique allocations, allocationsTas, octetsAlloues;
+    BigBinaryStats base;          // valeurs à la dernière remise à zéro (sous verrouStats)
+    struct StatsThread *suivant, *precedent;
+} StatsThread;
+
+static inline void incrementer(_Atomic CompteurAtomique *c, unsigned long long v) {
+    atomic_store_explicit(c, atomic_load_explicit(c, memory_order_relaxed) + v,
+                          memory_order_relaxed);
+}
+
+static inline unsigned long long lireCompteur(_Atomic CompteurAtomique *c) {
+    return atomic_load_explicit(c, memory_order_relaxed);
+}
+
+/* Valeurs courantes des compteurs de t (sans soustraire la base) */
+static void photographier(StatsThread *t, BigBinaryStats *out) {
+    for (int i = 0; i < BB_NB_PRIMITIVES; ++i) {
+        out->prim[i].appels = lireCompteur(&t->appels[i]);
+        out->prim[i].mots   = lireCompteur(&t->mots[i]);
+        out->prim[i].cycles = lireCompteur(&t->cycles[i]);
+    }
+    out->allocations    = lireCompteur(&t->allocations);
+    out->allocationsTas = lireCompteur(&t->allocationsTas);
+    out->octetsAlloues  = lireCompteur(&t->octetsAlloues);
+}
+
+/* Compteurs de t depuis la dernière remise à zéro (appelant : verrouStats pris) */
+static void lireThread(StatsThread *t, BigBinaryStats *out) {
+    photographier(t, out);
+    for (int i = 0; i < BB_NB_PRIMITIVES; ++i) {
+        out->prim[i].appels -= t->base.prim[i].appels;
+        out->prim[i].mots   -= t->base.prim[i].mots;
+        out->prim[i].cycles -= t->base.prim[i].cycles;
+    }
+    out->allocations    -= t->base.allocations;
+    out->allocationsTas -= t->base.allocationsTas;
+    out->octetsAlloues  -= t->base.octetsAlloues;
+}
+
+static pthread_mutex_t verrouStats = PTHREAD_MUTEX_INITIALIZER;
+static StatsThread *threadsVivants = NULL;
+static BigBinaryStats threadsTermines;   // cumul des threads finis
+
+static _Thread_local StatsThread *tl_stats = NULL;
+
+static pthread_key_t cleStats;
+static pthread_once_t cleUneFois = PTHREAD_ONCE_INIT;
+
+/* Fin du thread : verser ses compteurs dans le total, puis le retirer */
+static void retirerThread(void *p) {
+    StatsThread *t = (StatsThread*)p;
+    BigBinaryStats s;
+    pthread_mutex_lock(&verrouStats);
+    lireThread(t, &s);
+    cumuler(&threadsTermines, &s);
+    if (t->precedent) t->precedent->suivant = t->suivant;
+    else threadsVivants = t->suivant;
+    if (t->suivant) t->suivant->precedent = t->precedent;
+    pthread_mutex_unlock(&verrouStats);
+    free(t);
+}
+
+static void creerCle(void) {
+    pthread_key_create(&cleStats, retirerThread);
+}
+
+static StatsThread *statsDuThread(void) {
+    if (tl_stats != NULL) return tl_stats;
+
+    pthread_once(&cleUneFois, creerCle);
+    StatsThread *t = (StatsThread*)calloc(1, sizeof(StatsThread));
+    if (t == NULL) return NULL;
+
+    pthread_mutex_lock(&verrouStats);
+    t->suivant = threadsVivants;
+    if (threadsVivants) threadsVivants->precedent = t;
+    threadsVivants = t;
+    pthread_mutex_unlock(&verrouStats);
+
+    pthread_setspecific(cleStats, t);
+    tl_stats = t;
+    return t;
+}
+
+uint64_t bb_statHorloge(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint64_t)__rdtsc();
+#else
+    // Pas de compteur de cycles portable : nanosecondes
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+void bb_statAjouter(BigBinaryPrimitive p, uint64_t mots, uint64_t cycles) {
+    StatsThread *t = statsDuThread();
+    if (t == NULL) return;
+    incrementer(&t->appels[p], 1);
+    incrementer(&t->mots[p], mots);
+    incrementer(&t->cycles[p], cycles);
+}
+
+void bb_statAllocation(size_t octets, int surLeTas) {
+    StatsThread *t = statsDuThread();
+    if (t == NULL) return;
+    incrementer(&t->allocations, 1);
+    incrementer(&t->allocationsTas, surLeTas != 0);
+    incrementer(&t->octetsAlloues, octets);
+}
+
+int BigBinaryStats_active(void) {
+    return 1;
+}
+
+void BigBinaryStats_thread(BigBinaryStats *out) {
+    if (out == NULL) return;
+    memset(out, 0, sizeof(*out));
+    if (tl_stats == NULL) return;
+    pthread_mutex_lock(&verrouStats);   // base modifiable par une remise à zéro
+    lireThread(tl_stats, out);
+    pthread_mutex_unlock(&verrouStats);
+}
+
+/*
+ * Les compteurs des autres threads sont lus sans les arrêter : pendant un
+ * calcul, chaque compteur lu est une valeur qu'il a réellement eue, mais
+ * pas forcément au même instant que les autres (exact une fois les threads
+ * au repos).
+ */
+void BigBinaryStats_total(BigBinaryStats *out) {
+    if (out == NULL) return;
+    pthread_mutex_lock(&verrouStats);
+    *out = threadsTermines;
+    for (StatsThread *t = threadsVivants; t != NULL; t = t->suivant) {
+        BigBinaryStats s;
+        lireThread(t, &s);
+        cumuler(out, &s);
+    }
+    pthread_mutex_unlock(&verrouStats);
+}
+
+void BigBinaryStats_reinitialiser(void) {
+    pthread_mutex_lock(&verrouStats);
+    memset(&threadsTermines, 0, sizeof(threadsTermines));
+    for (StatsThread *t = threadsVivants; t != NULL; t = t->suivant)
+        photographier(t, &t->base);   // zéro = valeurs actuelles, sans écrire les compteurs
+    pthread_mutex_unlock(&verrouStats);
+}
+
+#else /* !BIGBINARY_INSTRUMENTATION */
+
+int BigBinaryStats_active(void) {
+    return 0;
+}
+
+void BigBinaryStats_thread(BigBinaryStats *out) {
+    if (out != NULL) memset(out, 0, sizeof(*out));
+}
+
+void BigBinaryStats_total(BigBinaryStats *out) {
+    if (out != NULL) memset(out, 0, sizeof(*out));
+}
+
+void BigBinaryStats_reinitialiser(void) {
+}
+
+#endif /* BIGBINARY_INSTRUMENTATION */
@@ -0,0 +1,425 @@
+/*
+ * ============================================================================
+ * MODE LOT : COMMANDES NON INTERACTIVES
+ * ============================================================================
+ *
+ * Le mode interactif de main.c lit une suite fixe de valeurs au clavier
+ * (1023 bits au plus) : inutilisable pour piloter la bibliothèque depuis
+ * un script ou mesurer un débit. Ici, une opération par ligne :
+ *
+ *   add A B          A + B
+ *   sub A B          A - B (signé : "-101" si B > A)
+ *   mod A N          A mod N
+ *   gcd A B          pgcd(A, B)
+ *   expmod M E N     M^E mod N
+ *   rsa-enc M E N    M^E mod N, M < N exigé
+ *   rsa-dec C D N    C^D mod N, C < N exigé
+ *
+ * Opérandes de taille quelconque, en binaire ("101" ou "0b101") ou en
+ * hexadécimal ("0x1f"). Lignes vides et commentaires (#) ignorés.
+ * Chaque commande produit une ligne, dans l'ordre de l'entrée : le
+ * résultat (binaire, ou hexadécimal avec --hex), ou
+ * "erreur ligne N : message" (code de sortie 1 à la fin).
+ *
+ * Même pipeline borné que rsa_flux (pipeline.c) :
+ *
+ *   lecteur (1 thread) → travailleurs (N threads) → écrivain (1 thread)
+ *
+ * mais les cases transportent des paquets de lignes (jusqu'à
+ * LIGNES_PAR_PAQUET) : une addition coûte moins que la prise d'un verrou.
+ * Chaque paquet accumule ses résultats dans un tampon, écrit d'un bloc ;
+ * la sortie elle-même a un tampon de 1 Mo.
+ *
+ * UTILISATION :
+ *   projet_C --lot [fichier|-] [-o sortie] [-t threads] [--hex]
+ * ============================================================================
+ */
+
+#include "commandes_lot.h"
+#include "bigbinary.h"
+#include "pipeline.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define LIGNES_PAR_PAQUET   64
+#define OCTETS_PAR_PAQUET   (64 * 1024)   // paquet clos plus tôt si les opérandes sont longs
+#define TAMPON_SORTIE       (1024 * 1024)
+#define OPERANDES_MAX       3
+
+/* Tampon de caractères extensible */
+typedef struct {
+    char *d;
+    size_t lg, cap;
+} Tampon;
+
+/* Contenu d'une case du pipeline */
+typedef struct {
+    long premiereLigne;       // numéro (à partir de 1) de la première ligne
+    int nbLignes;
+    Tampon texte;             // lignes terminées par '\0', à la suite
+    Tampon sortie;            // une ligne de résultat par commande
+    int nbErreurs;
+} Paquet;
+
+typedef struct {
+    // Paramètres
+    int hex;
+    FILE *in, *out;
+
+    // Lecteur seul
+    char *ligne;
+    size_t capLigne;
+    long numero;
+
+    // Commandes en échec (écrivain seul)
+    long nbErreurs;
+} Lot;
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "Usage : %s --lot [fichier|-] [-o sortie] [-t threads] [--hex]\n"
+            "  une commande par ligne : add|sub|mod|gcd A B, expmod|rsa-enc|rsa-dec X E N\n"
+            "  operandes en binaire (101, 0b101) ou hexadecimal (0x1f)\n", prog);
+}
+
+/* ===========================================================
+ *  Tampons
+ * =========================================================== */
+
+static void reserver(Tampon *t, size_t n) {
+    if (t->lg + n <= t->cap) return;
+    size_t cap = t->cap ? t->cap : 256;
+    while (cap < t->lg + n) cap *= 2;
+    t->d = (char*)realloc(t->d, cap);
+    t->cap = cap;
+}
+
+static void ajouter(Tampon *t, const char *s, size_t n) {
+    reserver(t, n);
+    memcpy(t->d + t->lg, s, n);
+    t->lg += n;
+}
+
+/* ===========================================================
+ *  Conversions des opérandes et des résultats
+ * =========================================================== */
+
+static int valeurHex(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/**
+ * lireOperande - Convertit un jeton en BigBinary
+ *
+ * CAS 1 : "0x…" → chiffres hexadécimaux regroupés en octets (poids fort
+ *   en premier), puis initBigBinaryFromBytes
+ * CAS 2 : "0b…" ou chiffres 0/1 → initBigBinaryFromString
+ *
+ * @return : 1 si le jeton est valide, 0 sinon (X n'est pas créé)
+ */
+int lireOperande(const char *s, BigBinary *X) {
+    if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+        const char *h = s + 2;
+        size_t n = strlen(h);
+        if (n == 0) return 0;
+        size_t nbOctets = (n + 1) / 2;
+        unsigned char *o = (unsigned char*)malloc(nbOctets);
+        // Nombre impair de chiffres : le premier octet n'a qu'un chiffre
+        size_t j = 0;
+        for (size_t i = 0; i < nbOctets; ++i) {
+            int fort = (i == 0 && (n & 1)) ? 0 : valeurHex(h[j++]);
+            int faible = valeurHex(h[j++]);
+            if (fort < 0 || faible < 0) {
+                free(o);
+                return 0;
+            }
+            o[i] = (unsigned char)(fort << 4 | faible);
+        }
+        *X = initBigBinaryFromBytes(o, nbOctets);
+        free(o);
+        return 1;
+    }
+
+    if (s[0] == '0' && (s[1] == 'b' || s[1] == 'B')) s += 2;
+    if (*s == '\0' || s[strspn(s, "01")] != '\0') return 0;
+    *X = initBigBinaryFromString(s);
+    return 1;
+}
+
+/* Ajoute R à la sortie (binaire ou hexadécimal, "-" si négatif) puis '\n' */
+static void ecrireResultat(Tampon *t, const BigBinary R, int hex) {
+    int bits = BigBinary_nbBits(R);
+    if (bits == 0) {
+        ajouter(t, hex ? "0x0\n" : "0\n", hex ? 4 : 2);
+        return;
+    }
+
+    size_t nbOctets = ((size_t)bits + 7) / 8;
+    unsigned char *o = (unsigned char*)malloc(nbOctets);
+    BigBinary_toBytes(R, o, nbOctets);
+
+    // Au plus : signe, "0x", un caractère par bit, '\n'
+    reserver(t, (size_t)bits + 4);
+    char *p = t->d + t->lg;
+    if (R.Signe) *p++ = '-';
+    if (hex) {
+        static const char CHIFFRES[] = "0123456789abcdef";
+        *p++ = '0';
+        *p++ = 'x';
+        for (size_t i = 0; i < nbOctets; ++i) {
+            if (i > 0 || (o[0] >> 4) != 0) *p++ = CHIFFRES[o[i] >> 4];
+            *p++ = CHIFFRES[o[i] & 15];
+        }
+    } else {
+        int debut = (int)(nbOctets * 8) - bits;   // bits de tête nuls du premier octet
+        for (int i = debut; i < (int)(nbOctets * 8); ++i)
+            *p++ = (char)('0' + ((o[i / 8] >> (7 - i % 8)) & 1));
+    }
+    *p++ = '\n';
+    t->lg = (size_t)(p - t->d);
+    free(o);
+}
+
+char *texteOperande(const BigBinary R, int hex) {
+    Tampon t = { NULL, 0, 0 };
+    ecrireResultat(&t, R, hex);
+    t.d[t.lg - 1] = '\0';   // le '\n' final
+    return t.d;
+}
+
+static void ecrireErreur(Tampon *t, long ligne, const char *msg) {
+    char entete[64];
+    int n = snprintf(entete, sizeof(entete), "erreur ligne %ld : ", ligne);
+    ajouter(t, entete, (size_t)n);
+    ajouter(t, msg, strlen(msg));
+    ajouter(t, "\n", 1);
+}
+
+/* ===========================================================
+ *  Exécution d'une commande
+ * =========================================================== */
+
+typedef enum { OP_ADD, OP_SUB, OP_MOD, OP_GCD, OP_EXPMOD, OP_RSA_ENC, OP_RSA_DEC } Operation;
+
+static const struct {
+    const char *nom;
+    Operation op;
+    int nbOperandes;
+} OPERATIONS[] = {
+    { "add", OP_ADD, 2 }, { "sub", OP_SUB, 2 }, { "mod", OP_MOD, 2 }, { "gcd", OP_GCD, 2 },
+    { "expmod", OP_EXPMOD, 3 }, { "rsa-enc", OP_RSA_ENC, 3 }, { "rsa-dec", OP_RSA_DEC, 3 },
+};
+#define NB_OPERATIONS ((int)(sizeof(OPERATIONS) / sizeof(OPERATIONS[0])))
+
+/**
+ * executerLigne - Analyse et exécute une ligne, écrit son résultat
+ *
+ * @param ligne : La ligne (modifiée par le découpage en jetons)
+ * @return : -1 si la ligne est vide ou un commentaire, 0 si la commande
+ *   a échoué, 1 sinon
+ */
+static int executerLigne(char *ligne, long numero, int hex, Tampon *sortie) {
+    char *suite = NULL;
+    const char *SEP = " \t\r\n";
+    char *nom = strtok_r(ligne, SEP, &suite);
+    if (nom == NULL || nom[0] == '#') return -1;
+
+    // ÉTAPE 1 : Opération
+    int k = 0;
+    while (k < NB_OPERATIONS && strcmp(OPERATIONS[k].nom, nom) != 0) k++;
+    if (k == NB_OPERATIONS) {
+        ecrireErreur(sortie, numero, "operation inconnue");
+        return 0;
+    }
+    Operation op = OPERATIONS[k].op;
+    int attendus = OPERATIONS[k].nbOperandes;
+
+    // ÉTAPE 2 : Opérandes
+    BigBinary X[OPERANDES_MAX];
+    int n = 0;
+    const char *msg = NULL;
+    char *jeton;
+    while ((jeton = strtok_r(NULL, SEP, &suite)) != NULL) {
+        if (n == attendus) {
+            msg = "trop d'operandes";
+            break;
+        }
+        if (!lireOperande(jeton, &X[n])) {
+            msg = "operande invalide";
+            break;
+        }
+        n++;
+    }
+    if (msg == NULL && n < attendus) msg = "operandes manquants";
+
+    // ÉTAPE 3 : Calcul (les cas que la bibliothèque refuserait sont écartés avant)
+    if (msg == NULL) {
+        BigBinary R = initBigBinary();
+        switch (op) {
+            case OP_ADD: R = additionBigBinary(X[0], X[1]); break;
+            case OP_SUB: R = BigBinary_soustractionSignee(X[0], X[1]); break;
+            case OP_GCD: R = pgcdBinaire(X[0], X[1]); break;
+            case OP_MOD:
+                if (estZero(X[1])) msg = "module nul";
+                else R = BigBinary_mod(X[0], X[1]);
+                break;
+            case OP_EXPMOD:
+                if (estZero(X[2])) msg = "module nul";
+                else R = BigBinary_expMod(X[0], X[1], X[2]);
+                break;
+            case OP_RSA_ENC:
+            case OP_RSA_DEC:
+                if (estZero(X[2])) msg = "module nul";
+                else if (BigBinary_cmp(X[0], X[2]) >= 0) msg = "message >= module";
+                else if (op == OP_RSA_ENC) R = BigBinary_RSA_encrypt(X[0], X[1], X[2]);
+                else R = BigBinary_RSA_decrypt(X[0], X[1], X[2]);
+                break;
+        }
+        if (msg == NULL) {
+            ecrireResultat(sortie, R, hex);
+            libereBigBinary(&R);
+        }
+    }
+
+    for (int i = 0; i < n; ++i) libereBigBinary(&X[i]);
+    if (msg != NULL) {
+        ecrireErreur(sortie, numero, msg);
+        return 0;
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * LECTEUR : regroupe les lignes en paquets
+ * ============================================================================ */
+
+static int lirePaquet(void *ctx, void *donnee, int *dernier, const char **msg) {
+    Lot *L = (Lot*)ctx;
+    Paquet *c = (Paquet*)donnee;
+
+    c->texte.lg = 0;
+    c->nbLignes = 0;
+    c->premiereLigne = L->numero + 1;
+    while (c->nbLignes < LIGNES_PAR_PAQUET && c->texte.lg < OCTETS_PAR_PAQUET) {
+        ssize_t lu = getline(&L->ligne, &L->capLigne, L->in);
+        if (lu < 0) {
+            if (ferror(L->in)) {
+                *msg = "lecture impossible";
+                return 0;
+            }
+            *dernier = 1;
+            break;
+        }
+        ajouter(&c->texte, L->ligne, (size_t)lu + 1);   // '\0' compris
+        c->nbLignes++;
+        L->numero++;
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * TRAVAILLEURS : exécutent les lignes d'un paquet
+ * ============================================================================ */
+
+static int traiterPaquet(void *ctx, void *donnee, const char **msg) {
+    const Lot *L = (const Lot*)ctx;
+    Paquet *c = (Paquet*)donnee;
+    (void)msg;   // une commande en échec produit sa ligne d'erreur, le lot continue
+
+    c->sortie.lg = 0;
+    c->nbErreurs = 0;
+    char *ligne = c->texte.d;
+    for (int i = 0; i < c->nbLignes; ++i) {
+        size_t lg = strlen(ligne);
+        if (executerLigne(ligne, c->premiereLigne + i, L->hex, &c->sortie) == 0) c->nbErreurs++;
+        ligne += lg + 1;
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * ÉCRIVAIN : écrit les paquets dans l'ordre de lecture
+ * ============================================================================ */
+
+static int ecrirePaquet(void *ctx, void *donnee, const char **msg) {
+    Lot *L = (Lot*)ctx;
+    const Paquet *c = (const Paquet*)donnee;
+    if (fwrite(c->sortie.d, 1, c->sortie.lg, L->out) != c->sortie.lg) {
+        *msg = "ecriture impossible";
+        return 0;
+    }
+    L->nbErreurs += c->nbErreurs;
+    return 1;
+}
+
+/* ============================================================================
+ * POINT D'ENTRÉE
+ * ============================================================================ */
+
+int modeLot(int argc, char **argv) {
+    const char *inNom = "-", *outNom = "-";
+    long nbTravailleurs = sysconf(_SC_NPROCESSORS_ONLN);
+    int hex = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--hex") == 0) hex = 1;
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) outNom = argv[++i];
+        else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) nbTravailleurs = atol(argv[++i]);
+        else if (argv[i][0] != '-' || strcmp(argv[i], "-") == 0) inNom = argv[i];
+        else {
+            usage("projet_C");
+            return 1;
+        }
+    }
+    if (nbTravailleurs < 1) nbTravailleurs = 1;
+
+    Lot L;
+    memset(&L, 0, sizeof(L));
+    L.hex = hex;
+
+    // Entrée d'abord : une entrée introuvable ne doit pas vider le fichier de sortie
+    L.in = (strcmp(inNom, "-") == 0) ? stdin : fopen(inNom, "r");
+    if (L.in == NULL) {
+        fprintf(stderr, "Erreur: impossible d'ouvrir %s\n", inNom);
+        return 1;
+    }
+    L.out = (strcmp(outNom, "-") == 0) ? stdout : fopen(outNom, "w");
+    if (L.out == NULL) {
+        fprintf(stderr, "Erreur: impossible d'ouvrir %s\n", outNom);
+        if (L.in != stdin) fclose(L.in);
+        return 1;
+    }
+    static char tamponSortie[TAMPON_SORTIE];   // doit survivre jusqu'à la sortie du programme
+    setvbuf(L.out, tamponSortie, _IOFBF, TAMPON_SORTIE);
+
+    int profondeur = 4 * (int)nbTravailleurs;
+    Paquet *paquets = (Paquet*)calloc((size_t)profondeur, sizeof(Paquet));
+
+    static const PipelineRappels rappels = { lirePaquet, traiterPaquet, ecrirePaquet };
+    int erreur = !executerPipeline(&rappels, &L, paquets, sizeof(Paquet),
+                                   profondeur, (int)nbTravailleurs, NULL);
+
+    // Les derniers paquets peuvent n'atteindre le disque qu'ici (tampon de 1 Mo)
+    int echecEcriture = fflush(L.out) != 0;
+    if (L.out != stdout && fclose(L.out) != 0) echecEcriture = 1;
+    if (echecEcriture) {
+        if (!erreur) fprintf(stderr, "Erreur: ecriture impossible\n");
+        erreur = 1;
+    }
+    int code = (erreur || L.nbErreurs > 0) ? 1 : 0;
+
+    // Libération
+    for (int i = 0; i < profondeur; ++i) {
+        free(paquets[i].texte.d);
+        free(paquets[i].sortie.d);
+    }
+    free(paquets);
+    free(L.ligne);
+    if (L.in != stdin) fclose(L.in);
+    return code;
+}
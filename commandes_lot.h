@@ -0,0 +1,29 @@
+#ifndef COMMANDES_LOT_H
+#define COMMANDES_LOT_H
+
+#include "bigbinary.h"
+
+/**
+ * modeLot() : Exécute un fichier de commandes (une opération par ligne)
+ *
+ * Paramètres : argc, argv = arguments qui suivent "--lot"
+ *              [fichier|-] [-o sortie] [-t threads] [--hex]
+ * Retour : 0 si toutes les commandes ont réussi, 1 sinon
+ */
+int modeLot(int argc, char **argv);
+
+/**
+ * lireOperande() : Jeton texte → BigBinary ("101", "0b101" ou "0x1f")
+ *
+ * Retour : 1 si le jeton est valide (X à libérer), 0 sinon
+ */
+int lireOperande(const char *s, BigBinary *X);
+
+/**
+ * texteOperande() : BigBinary → texte (binaire, ou "0x…" si hex ≠ 0)
+ *
+ * Retour : chaîne allouée (free), "-" en tête si R est négatif
+ */
+char *texteOperande(const BigBinary R, int hex);
+
+#endif
@@ -16,11 +16,17 @@
  *   - Partie 2 : PGCD binaire (algorithme de Stein)
  *   - Partie 3 : Modulo et exponentiation modulaire
  * 
+ * MODE LOT (commandes_lot.c) : projet_C --lot [fichier|-] [-o sortie]
+ *   [-t threads] [--hex] exécute une opération par ligne, sans question,
+ *   opérandes de taille quelconque.
+ * 
  * ============================================================================
  */
 
 #include "bigbinary.h"
+#include "commandes_lot.h"
 #include <stdio.h>
+#include <string.h>
 
 static int binstr_to_u64(const char *s, unsigned long long *out) {
     if (!s || !*s) return 0;
@@ -99,7 +105,10 @@ static void show(const char *label, BigBinary X) {
     afficheBigBinary(X);
 }
 
-int main(void) {
+int main(int argc, char **argv) {
+    // Mode lot : aucune question, tout vient du fichier de commandes
+    if (argc > 1 && strcmp(argv[1], "--lot") == 0) return modeLot(argc - 1, argv + 1);
+
     /*
      * ========================================================================
      * PHASE 1 – VÉRIFICATION DES OPÉRATIONS DE BASE
@@ -381,7 +390,7 @@ int main(void) {
     printf("d (bin) = %s\n", dStr);
 
     // Si M >= n, on réduit : M = M mod n
-    if (!Inferieur(MBB, nBB) || Egal(MBB, nBB)) {
+    if (BigBinary_cmp(MBB, nBB) >= 0) {
         BigBinary Mr = BigBinary_mod(MBB, nBB);
         libereBigBinary(&MBB);
         MBB = Mr;
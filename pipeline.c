@@ -0,0 +1,209 @@
+#include "pipeline.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* État d'une case du tampon circulaire */
+enum {
+    CASE_LIBRE,     // disponible pour le lecteur
+    CASE_LUE,       // remplie, en attente d'un travailleur
+    CASE_EN_COURS,  // prise par un travailleur
+    CASE_FAITE      // résultat prêt pour l'écrivain
+};
+
+typedef struct {
+    int etat;
+    int dernier;              // 1 si c'est le dernier élément du flux
+} Case;
+
+typedef struct {
+    const PipelineRappels *r;
+    void *ctx;
+    char *donnees;
+    size_t tailleDonnee;
+
+    // Tampon circulaire borné
+    Case *cases;
+    int profondeur;
+
+    // Numéros de séquence
+    long long nbLus;        // cases déposées par le lecteur
+    long long nbPris;       // cases prises par les travailleurs
+    long long nbEcrits;     // cases écrites
+    int finLecture;         // le lecteur a déposé le dernier élément
+    int erreur;
+
+    pthread_mutex_t verrou;
+    pthread_cond_t condLecteur;     // une case s'est libérée
+    pthread_cond_t condTravail;     // une case est lue
+    pthread_cond_t condEcrivain;    // une case est faite
+} Pipeline;
+
+static void *donneeCase(const Pipeline *P, long long numero) {
+    return P->donnees + (size_t)(numero % P->profondeur) * P->tailleDonnee;
+}
+
+/* Marque une erreur (message affiché une seule fois) et réveille tout le monde */
+static void signalerErreur(Pipeline *P, const char *msg) {
+    pthread_mutex_lock(&P->verrou);
+    if (!P->erreur) fprintf(stderr, "Erreur: %s\n", msg ? msg : "pipeline interrompu");
+    P->erreur = 1;
+    pthread_cond_broadcast(&P->condLecteur);
+    pthread_cond_broadcast(&P->condTravail);
+    pthread_cond_broadcast(&P->condEcrivain);
+    pthread_mutex_unlock(&P->verrou);
+}
+
+/* ============================================================================
+ * LECTEUR : remplit les cases libres dans l'ordre
+ * ============================================================================ */
+
+static void *lecteur(void *arg) {
+    Pipeline *P = (Pipeline*)arg;
+
+    for (;;) {
+        // Attendre une case libre
+        pthread_mutex_lock(&P->verrou);
+        Case *c = &P->cases[P->nbLus % P->profondeur];
+        while (!P->erreur && c->etat != CASE_LIBRE)
+            pthread_cond_wait(&P->condLecteur, &P->verrou);
+        int arret = P->erreur;
+        void *d = donneeCase(P, P->nbLus);
+        pthread_mutex_unlock(&P->verrou);
+        if (arret) break;
+
+        // La remplir hors verrou (personne d'autre ne touche une case libre)
+        int dernier = 0;
+        const char *msg = NULL;
+        if (!P->r->lire(P->ctx, d, &dernier, &msg)) {
+            signalerErreur(P, msg);
+            break;
+        }
+
+        pthread_mutex_lock(&P->verrou);
+        c->dernier = dernier;
+        c->etat = CASE_LUE;
+        P->nbLus++;
+        if (dernier) P->finLecture = 1;
+        pthread_cond_signal(&P->condTravail);
+        pthread_mutex_unlock(&P->verrou);
+        if (dernier) break;
+    }
+    return NULL;
+}
+
+/* ============================================================================
+ * TRAVAILLEURS : traitent les cases lues
+ * ============================================================================ */
+
+static void *travailleur(void *arg) {
+    Pipeline *P = (Pipeline*)arg;
+
+    pthread_mutex_lock(&P->verrou);
+    for (;;) {
+        // Attendre une case lue et pas encore prise
+        while (!P->erreur && P->nbPris == P->nbLus && !P->finLecture)
+            pthread_cond_wait(&P->condTravail, &P->verrou);
+        if (P->erreur || P->nbPris == P->nbLus) break;  // plus rien à faire
+
+        Case *c = &P->cases[P->nbPris % P->profondeur];
+        void *d = donneeCase(P, P->nbPris);
+        P->nbPris++;
+        c->etat = CASE_EN_COURS;
+        pthread_mutex_unlock(&P->verrou);
+
+        const char *msg = NULL;
+        int ok = P->r->traiter(P->ctx, d, &msg);
+
+        if (!ok) {
+            signalerErreur(P, msg);
+            return NULL;
+        }
+        pthread_mutex_lock(&P->verrou);
+        c->etat = CASE_FAITE;
+        pthread_cond_broadcast(&P->condEcrivain);
+    }
+    // Réveiller les autres travailleurs qui attendent encore
+    pthread_cond_broadcast(&P->condTravail);
+    pthread_mutex_unlock(&P->verrou);
+    return NULL;
+}
+
+/* ============================================================================
+ * ÉCRIVAIN : écrit les cases dans l'ordre de lecture
+ * ============================================================================ */
+
+static void *ecrivain(void *arg) {
+    Pipeline *P = (Pipeline*)arg;
+
+    pthread_mutex_lock(&P->verrou);
+    for (;;) {
+        Case *c = &P->cases[P->nbEcrits % P->profondeur];
+        while (!P->erreur && c->etat != CASE_FAITE)
+            pthread_cond_wait(&P->condEcrivain, &P->verrou);
+        if (P->erreur) break;
+        void *d = donneeCase(P, P->nbEcrits);
+        int dernier = c->dernier;
+        pthread_mutex_unlock(&P->verrou);
+
+        const char *msg = NULL;
+        if (!P->r->ecrire(P->ctx, d, &msg)) {
+            signalerErreur(P, msg);
+            return NULL;
+        }
+
+        pthread_mutex_lock(&P->verrou);
+        c->etat = CASE_LIBRE;
+        P->nbEcrits++;
+        pthread_cond_signal(&P->condLecteur);
+        if (dernier) break;
+    }
+    pthread_mutex_unlock(&P->verrou);
+    return NULL;
+}
+
+/* ============================================================================
+ * EXÉCUTION
+ * ============================================================================ */
+
+int executerPipeline(const PipelineRappels *r, void *ctx, void *donnees, size_t tailleDonnee,
+                     int profondeur, int nbTravailleurs, long long *nbEcrits) {
+    if (profondeur < 1) profondeur = 1;
+    if (nbTravailleurs < 1) nbTravailleurs = 1;
+
+    Pipeline P = { 0 };
+    P.r = r;
+    P.ctx = ctx;
+    P.donnees = (char*)donnees;
+    P.tailleDonnee = tailleDonnee;
+    P.profondeur = profondeur;
+    P.cases = (Case*)calloc((size_t)profondeur, sizeof(Case));
+
+    pthread_mutex_init(&P.verrou, NULL);
+    pthread_cond_init(&P.condLecteur, NULL);
+    pthread_cond_init(&P.condTravail, NULL);
+    pthread_cond_init(&P.condEcrivain, NULL);
+
+    pthread_t thLecteur, thEcrivain;
+    pthread_t *thTravailleurs = (pthread_t*)malloc((size_t)nbTravailleurs * sizeof(pthread_t));
+    pthread_create(&thLecteur, NULL, lecteur, &P);
+    for (int i = 0; i < nbTravailleurs; ++i)
+        pthread_create(&thTravailleurs[i], NULL, travailleur, &P);
+    pthread_create(&thEcrivain, NULL, ecrivain, &P);
+
+    pthread_join(thLecteur, NULL);
+    for (int i = 0; i < nbTravailleurs; ++i)
+        pthread_join(thTravailleurs[i], NULL);
+    pthread_join(thEcrivain, NULL);
+
+    if (nbEcrits != NULL) *nbEcrits = P.nbEcrits;
+    int ok = !P.erreur;
+
+    pthread_mutex_destroy(&P.verrou);
+    pthread_cond_destroy(&P.condLecteur);
+    pthread_cond_destroy(&P.condTravail);
+    pthread_cond_destroy(&P.condEcrivain);
+    free(thTravailleurs);
+    free(P.cases);
+    return ok;
+}
@@ -0,0 +1,49 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stddef.h>
+
+/*
+ * ============================================================================
+ * PIPELINE ORDONNÉ BORNÉ (rsa_flux, mode lot de projet_C)
+ * ============================================================================
+ *
+ *   lecteur (1 thread) → travailleurs (N threads) → écrivain (1 thread)
+ *
+ * Les éléments circulent dans un tampon circulaire de "profondeur" cases :
+ * la mémoire reste bornée quelle que soit la taille de l'entrée, et
+ * l'écrivain les reçoit dans l'ordre de lecture. Le contenu d'une case
+ * (bloc, paquet de lignes...) appartient à l'appelant : le pipeline ne
+ * gère que leur état et les threads.
+ *
+ * Chaque rappel est appelé hors verrou, sur une case que personne d'autre
+ * ne touche à ce moment. Il retourne 1 si tout va bien, 0 en cas d'erreur
+ * en plaçant un message dans *msg : le pipeline affiche "Erreur: msg" une
+ * seule fois et arrête tous les threads.
+ * ============================================================================
+ */
+
+typedef struct {
+    // Remplit une case libre ; *dernier = 1 pour le dernier élément du flux
+    int (*lire)(void *ctx, void *donnee, int *dernier, const char **msg);
+
+    // Traite une case lue (plusieurs travailleurs en parallèle)
+    int (*traiter)(void *ctx, void *donnee, const char **msg);
+
+    // Écrit une case traitée (dans l'ordre de lecture)
+    int (*ecrire)(void *ctx, void *donnee, const char **msg);
+} PipelineRappels;
+
+/**
+ * executerPipeline() : Fait passer tout le flux dans le pipeline
+ *
+ * Paramètres : donnees = tableau de "profondeur" cases de tailleDonnee octets
+ *                        (préparées par l'appelant)
+ *              ctx = passé tel quel aux rappels
+ *              nbEcrits = reçoit le nombre de cases écrites (NULL accepté)
+ * Retour : 1 si tout le flux a été écrit, 0 après une erreur
+ */
+int executerPipeline(const PipelineRappels *r, void *ctx, void *donnees, size_t tailleDonnee,
+                     int profondeur, int nbTravailleurs, long long *nbEcrits);
+
+#endif
@@ -0,0 +1,353 @@
+/*
+ * ============================================================================
+ * RSA_FLUX : CHIFFREMENT / DÉCHIFFREMENT DE FICHIERS PAR BLOCS
+ * ============================================================================
+ *
+ * Fait passer un fichier de taille quelconque dans BigBinary_RSA_encrypt /
+ * BigBinary_RSA_decrypt, bloc par bloc, avec le pipeline borné de pipeline.c :
+ *
+ *   lecteur (1 thread) → travailleurs (N threads, expMod) → écrivain (1 thread)
+ *
+ * L'écrivain remet les blocs dans l'ordre de lecture. Au plus "profondeur"
+ * blocs sont en vol en même temps, donc la mémoire reste bornée quelle que
+ * soit la taille du fichier.
+ *
+ * FORMAT DES BLOCS (module n de k bits) :
+ *   - bloc clair   : (k-1)/8 octets  → entier toujours < n
+ *   - bloc chiffré : (k+7)/8 octets
+ *   - le dernier bloc clair est complété par 0x80 puis des 0x00 (il y a
+ *     toujours un bloc de remplissage, même si le fichier tombe juste)
+ *   - le fichier chiffré commence par "BBR1" + k sur 4 octets
+ *
+ * UTILISATION :
+ *   rsa_flux chiffre   -n <n binaire> -k <e binaire> [-i in] [-o out] [-t N] [-q P]
+ *   rsa_flux dechiffre -n <n binaire> -k <d binaire> [-i in] [-o out] [-t N] [-q P]
+ *
+ * Le débit (Mo/s) est affiché sur stderr à la fin.
+ * ============================================================================
+ */
+
+#include "bigbinary.h"
+#include "pipeline.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAGIC "BBR1"
+
+/* Contenu d'une case du pipeline */
+typedef struct {
+    int dernier;              // 1 si c'est le dernier bloc du flux
+    size_t lgEntree;          // octets valides dans entree
+    unsigned char *entree;    // bloc lu
+    unsigned char *sortie;    // bloc produit
+    size_t lgSortie;          // octets à écrire
+} Bloc;
+
+typedef struct {
+    // Paramètres
+    int chiffrer;
+    BigBinary n, k;
+    size_t tailleClair, tailleChiffre;
+    FILE *in, *out;
+
+    // Déchiffrement : on garde toujours un bloc d'avance pour savoir lequel est le dernier
+    unsigned char *suivant;
+    int amorce;             // le premier bloc a été lu dans suivant
+
+    // Statistiques
+    unsigned long long octetsLus;   // écrit par le lecteur seul (remplissage exclu)
+} Flux;
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "Usage : %s chiffre|dechiffre -n <module> -k <exposant> "
+            "[-i entree] [-o sortie] [-t threads] [-q profondeur]\n"
+            "  (module et exposant en binaire, '-' = stdin/stdout)\n", prog);
+}
+
+static double maintenant(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Lit exactement n octets (sauf fin de fichier ou erreur : voir ferror) */
+static size_t lireTout(FILE *f, unsigned char *buf, size_t n) {
+    size_t total = 0;
+    while (total < n) {
+        size_t r = fread(buf + total, 1, n - total, f);
+        if (r == 0) break;
+        total += r;
+    }
+    return total;
+}
+
+/* ============================================================================
+ * LECTEUR : découpe l'entrée en blocs
+ * ============================================================================ */
+
+static int lireBloc(void *ctx, void *donnee, int *dernier, const char **msg) {
+    Flux *F = (Flux*)ctx;
+    Bloc *b = (Bloc*)donnee;
+
+    if (F->chiffrer) {
+        size_t taille = F->tailleClair;
+        size_t lg = lireTout(F->in, b->entree, taille);
+        F->octetsLus += lg;
+        if (lg < taille && ferror(F->in)) {   // pas une fin de fichier : ne pas remplir
+            *msg = "lecture impossible";
+            return 0;
+        }
+
+        // Tant que le bloc est plein, il n'est pas le dernier (padding obligatoire)
+        if (lg < taille) {
+            // Dernier bloc : ajouter 0x80 puis des zéros
+            b->entree[lg] = 0x80;
+            memset(b->entree + lg + 1, 0, taille - lg - 1);
+            *dernier = 1;
+        }
+        b->lgEntree = taille;
+    } else {
+        size_t taille = F->tailleChiffre;
+        if (!F->amorce) {
+            F->amorce = 1;
+            size_t lg = lireTout(F->in, F->suivant, taille);
+            F->octetsLus += lg;
+            if (lg != taille && ferror(F->in)) {
+                *msg = "lecture impossible";
+                return 0;
+            }
+            if (lg != taille) {
+                *msg = "fichier chiffre tronque";
+                return 0;
+            }
+        }
+        memcpy(b->entree, F->suivant, taille);
+        b->lgEntree = taille;
+
+        size_t lg2 = lireTout(F->in, F->suivant, taille);
+        F->octetsLus += lg2;
+        if (lg2 != taille && ferror(F->in)) {
+            *msg = "lecture impossible";
+            return 0;
+        }
+        if (lg2 == 0) *dernier = 1;
+        else if (lg2 != taille) {
+            *msg = "fichier chiffre tronque";
+            return 0;
+        }
+    }
+    b->dernier = *dernier;
+    return 1;
+}
+
+/* ============================================================================
+ * TRAVAILLEURS : exponentiation modulaire sur chaque bloc
+ * ============================================================================ */
+
+static int traiterBloc(void *ctx, void *donnee, const char **msg) {
+    const Flux *F = (const Flux*)ctx;
+    Bloc *b = (Bloc*)donnee;
+    *msg = "bloc invalide (mauvaise cle ou fichier corrompu)";
+
+    BigBinary X = initBigBinaryFromBytes(b->entree, b->lgEntree);
+
+    // Un bloc chiffré doit être < n, sinon le fichier ne vient pas de cette clé
+    if (!F->chiffrer && !Inferieur(X, F->n)) {
+        libereBigBinary(&X);
+        return 0;
+    }
+
+    BigBinary Y = F->chiffrer ? BigBinary_RSA_encrypt(X, F->k, F->n)
+                              : BigBinary_RSA_decrypt(X, F->k, F->n);
+    libereBigBinary(&X);
+
+    size_t tailleSortie = F->chiffrer ? F->tailleChiffre : F->tailleClair;
+    int ok = BigBinary_toBytes(Y, b->sortie, tailleSortie);
+    libereBigBinary(&Y);
+    if (!ok) return 0;
+
+    b->lgSortie = tailleSortie;
+
+    // Dernier bloc déchiffré : retirer le remplissage 0x80 00 ... 00
+    if (!F->chiffrer && b->dernier) {
+        size_t i = tailleSortie;
+        while (i > 0 && b->sortie[i - 1] == 0x00) i--;
+        if (i == 0 || b->sortie[i - 1] != 0x80) return 0;
+        b->lgSortie = i - 1;
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * ÉCRIVAIN : écrit les blocs dans l'ordre de lecture
+ * ============================================================================ */
+
+static int ecrireBloc(void *ctx, void *donnee, const char **msg) {
+    Flux *F = (Flux*)ctx;
+    const Bloc *b = (const Bloc*)donnee;
+    if (fwrite(b->sortie, 1, b->lgSortie, F->out) != b->lgSortie) {
+        *msg = "ecriture impossible";
+        return 0;
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * PROGRAMME PRINCIPAL
+ * ============================================================================ */
+
+static void ecrireU32(unsigned char *p, unsigned long v) {
+    p[0] = (unsigned char)(v >> 24);
+    p[1] = (unsigned char)(v >> 16);
+    p[2] = (unsigned char)(v >> 8);
+    p[3] = (unsigned char)v;
+}
+
+static unsigned long lireU32(const unsigned char *p) {
+    return ((unsigned long)p[0] << 24) | ((unsigned long)p[1] << 16)
+         | ((unsigned long)p[2] << 8) | (unsigned long)p[3];
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int chiffrer;
+    if (strcmp(argv[1], "chiffre") == 0) chiffrer = 1;
+    else if (strcmp(argv[1], "dechiffre") == 0) chiffrer = 0;
+    else {
+        usage(argv[0]);
+        return 1;
+    }
+
+    const char *nStr = NULL, *kStr = NULL;
+    const char *inNom = "-", *outNom = "-";
+    long nbTravailleurs = sysconf(_SC_NPROCESSORS_ONLN);
+    int profondeur = 0;
+
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        if (strcmp(argv[i], "-n") == 0) nStr = argv[++i];
+        else if (strcmp(argv[i], "-k") == 0) kStr = argv[++i];
+        else if (strcmp(argv[i], "-i") == 0) inNom = argv[++i];
+        else if (strcmp(argv[i], "-o") == 0) outNom = argv[++i];
+        else if (strcmp(argv[i], "-t") == 0) nbTravailleurs = atol(argv[++i]);
+        else if (strcmp(argv[i], "-q") == 0) profondeur = atoi(argv[++i]);
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (nStr == NULL || kStr == NULL) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (nbTravailleurs < 1) nbTravailleurs = 1;
+    if (profondeur < 1) profondeur = 4 * (int)nbTravailleurs;
+
+    Flux F;
+    memset(&F, 0, sizeof(F));
+    F.chiffrer = chiffrer;
+    F.n = initBigBinaryFromString(nStr);
+    F.k = initBigBinaryFromString(kStr);
+
+    int bits = BigBinary_nbBits(F.n);
+    if (bits < 9) {
+        fprintf(stderr, "Erreur: le module doit faire au moins 9 bits\n");
+        libereBigBinary(&F.n);
+        libereBigBinary(&F.k);
+        return 1;
+    }
+    F.tailleClair = (size_t)(bits - 1) / 8;
+    F.tailleChiffre = (size_t)(bits + 7) / 8;
+
+    // Entrée d'abord : une entrée introuvable ne doit pas vider le fichier de sortie
+    F.in = (strcmp(inNom, "-") == 0) ? stdin : fopen(inNom, "rb");
+    if (F.in == NULL) {
+        fprintf(stderr, "Erreur: impossible d'ouvrir %s\n", inNom);
+        libereBigBinary(&F.n);
+        libereBigBinary(&F.k);
+        return 1;
+    }
+
+    // En-tête : vérifie que le fichier a été chiffré avec un module de même taille
+    unsigned char entete[8];
+    if (!chiffrer && (lireTout(F.in, entete, sizeof(entete)) != sizeof(entete)
+                      || memcmp(entete, MAGIC, 4) != 0
+                      || lireU32(entete + 4) != (unsigned long)bits)) {
+        fprintf(stderr, "Erreur: %s\n", ferror(F.in) ? "lecture impossible"
+                                                     : "en-tete absent ou module different");
+        if (F.in != stdin) fclose(F.in);
+        libereBigBinary(&F.n);
+        libereBigBinary(&F.k);
+        return 1;
+    }
+
+    F.out = (strcmp(outNom, "-") == 0) ? stdout : fopen(outNom, "wb");
+    if (F.out == NULL) {
+        fprintf(stderr, "Erreur: impossible d'ouvrir %s\n", outNom);
+        if (F.in != stdin) fclose(F.in);
+        libereBigBinary(&F.n);
+        libereBigBinary(&F.k);
+        return 1;
+    }
+    int echecEcriture = 0;
+    if (chiffrer) {
+        memcpy(entete, MAGIC, 4);
+        ecrireU32(entete + 4, (unsigned long)bits);
+        echecEcriture = fwrite(entete, 1, sizeof(entete), F.out) != sizeof(entete);
+    }
+
+    // Tampon circulaire : chaque case contient un bloc d'entrée et de sortie
+    Bloc *blocs = (Bloc*)calloc((size_t)profondeur, sizeof(Bloc));
+    for (int i = 0; i < profondeur; ++i) {
+        blocs[i].entree = (unsigned char*)malloc(F.tailleChiffre);
+        blocs[i].sortie = (unsigned char*)malloc(F.tailleChiffre);
+    }
+    F.suivant = (unsigned char*)malloc(F.tailleChiffre);
+
+    double t0 = maintenant();
+
+    static const PipelineRappels rappels = { lireBloc, traiterBloc, ecrireBloc };
+    long long nbEcrits = 0;
+    int erreur = !executerPipeline(&rappels, &F, blocs, sizeof(Bloc),
+                                   profondeur, (int)nbTravailleurs, &nbEcrits);
+
+    // Les derniers blocs peuvent n'atteindre le disque qu'ici (tampon, disque plein)
+    if (fflush(F.out) != 0) echecEcriture = 1;
+    if (F.out != stdout && fclose(F.out) != 0) echecEcriture = 1;
+    if (echecEcriture) {
+        if (!erreur) fprintf(stderr, "Erreur: ecriture impossible\n");
+        erreur = 1;
+    }
+    double duree = maintenant() - t0;
+    if (duree <= 0.0) duree = 1e-9;
+
+    fprintf(stderr, "%s : %llu octets lus, %lld blocs, %.3f s, %.3f Mo/s (%ld travailleurs)\n",
+            chiffrer ? "chiffrement" : "dechiffrement",
+            F.octetsLus, nbEcrits, duree,
+            (double)F.octetsLus / duree / 1e6, nbTravailleurs);
+
+    int code = erreur ? 1 : 0;
+
+    // Libération
+    for (int i = 0; i < profondeur; ++i) {
+        free(blocs[i].entree);
+        free(blocs[i].sortie);
+    }
+    free(blocs);
+    free(F.suivant);
+    if (F.in != stdin) fclose(F.in);
+    libereBigBinary(&F.n);
+    libereBigBinary(&F.k);
+    return code;
+}
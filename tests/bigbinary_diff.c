@@ -0,0 +1,999 @@
+/*
+ * ============================================================================
+ * TEST DIFFÉRENTIEL : bibliothèque rapide contre implémentation de référence
+ * ============================================================================
+ *
+ * Chaque chemin rapide de bigbinary.c (mots de 64 bits, décalages par mots,
+ * noyaux spécialisés à venir) doit donner exactement le même résultat que
+ * l'implémentation bit à bit d'origine (bigbinary_reference.c).
+ *
+ * Neuf séries :
+ *   1. cas limites : 0, 1, puissances de 2, nombres "tout à 1", tailles
+ *      autour des seuils (mot de 64 bits, stockage interne de 256 bits) ;
+ *   2. opérandes aléatoires de tailles aléatoires ;
+ *      (séries 1 et 2 : les opérations bit à bit, sans équivalent dans la
+ *      référence, sont vérifiées par un calcul direct sur les chaînes)
+ *   3. petites tailles (≤ 64 bits) recalculées avec unsigned __int128,
+ *      indépendamment des deux implémentations ;
+ *   4. exponentiation par lots : chaque moteur disponible sur ce CPU
+ *      (AVX-512 IFMA, AVX2, scalaire) contre la référence ;
+ *   5. types de largeur fixe (bigbinary_fixe.h) : add / sub / cmp contre la
+ *      référence, expMod contre la référence jusqu'à 512 bits et contre
+ *      BigBinary_expMod au-delà (la référence bit à bit y serait trop lente) ;
+ *   6. audit de modules faibles (bigbinary_facteurs.c) sur des modules
+ *      construits pour chaque méthode : le facteur rendu doit diviser N ;
+ *   7. racines carrées modulaires, un premier par chemin (p ≡ 3 mod 4,
+ *      p ≡ 5 mod 8, p − 1 divisible par 2^23 et 2^40) : r² ≡ a, et une
+ *      racine existe exactement quand le symbole de Jacobi vaut 1 ;
+ *   8. inverses modulaires par lots : chaque sortie contre l'inverse
+ *      seul (lui-même vérifié en série 3), avec et sans élément non
+ *      inversible dans le lot ;
+ *   9. nombres aléatoires : vecteurs connus de xoshiro256** et ChaCha20,
+ *      BigBinary_random contre les mêmes mots tirés un par un, et
+ *      BigBinary_randomBelow(n) < n.
+ *
+ * UTILISATION :
+ *   bigbinary_diff [--iterations N] [--max-bits N] [--seed N] [--noyaux nom]
+ *
+ * --noyaux impose les noyaux de multiplication ("bmi2-adx", "portable") ou
+ * d'opérations bit à bit ("avx2", "portable") au lieu de ceux détectés :
+ * chaque version est ainsi comparée à la référence.
+ *
+ * Code de sortie : 0 si tout concorde, 1 sinon (premières divergences
+ * détaillées sur stderr).
+ * ============================================================================
+ */
+
+#include "bigbinary.h"
+#include "bigbinary_fixe.h"
+#include "bigbinary_reference.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ITERATIONS_DEFAUT   300
+#define BITS_MAX_DEFAUT     1024
+#define BITS_MAX_EXPMOD     160     // la référence est bit à bit : rester raisonnable
+#define ECHECS_AFFICHES     10
+
+static const int TAILLES_LIMITES[] = {
+    1, 2, 3, 63, 64, 65, 127, 128, 129, 191, 192, 193, 255, 256, 257, 320, 511, 512, 513
+};
+#define NB_TAILLES_LIMITES ((int)(sizeof(TAILLES_LIMITES) / sizeof(TAILLES_LIMITES[0])))
+
+static const int DECALAGES[] = { 0, 1, 2, 31, 63, 64, 65, 127, 128, 129, 200, 257 };
+#define NB_DECALAGES ((int)(sizeof(DECALAGES) / sizeof(DECALAGES[0])))
+
+static long nbVerifications = 0;
+static long nbEchecs = 0;
+
+/* ===========================================================
+ *  Générateur pseudo-aléatoire (xorshift64*) et opérandes
+ * =========================================================== */
+
+static unsigned long long etatAlea = 0x9E3779B97F4A7C15ULL;
+
+static unsigned long long alea64(void) {
+    etatAlea ^= etatAlea >> 12;
+    etatAlea ^= etatAlea << 25;
+    etatAlea ^= etatAlea >> 27;
+    return etatAlea * 0x2545F4914F6CDD1DULL;
+}
+
+/* Formes d'opérandes : les cas limites en premier */
+typedef enum {
+    FORME_ZERO,
+    FORME_UN,
+    FORME_PUISSANCE2,     // 1000...0
+    FORME_TOUT_UN,        // 1111...1
+    FORME_CREUX,          // quelques bits à 1
+    FORME_ALEATOIRE,      // bit de tête à 1, reste aléatoire
+    NB_FORMES
+} Forme;
+
+/* Écriture binaire d'un nombre de "bits" bits de la forme demandée (free) */
+static char *tirerChaine(int bits, Forme forme) {
+    if (bits < 1) bits = 1;
+    char *s = (char*)malloc((size_t)bits + 1);
+
+    for (int i = 0; i < bits; ++i) {
+        switch (forme) {
+            case FORME_ZERO:       s[i] = '0'; break;
+            case FORME_UN:         s[i] = (i == bits - 1) ? '1' : '0'; break;
+            case FORME_PUISSANCE2: s[i] = (i == 0) ? '1' : '0'; break;
+            case FORME_TOUT_UN:    s[i] = '1'; break;
+            case FORME_CREUX:      s[i] = (i == 0 || alea64() % 61 == 0) ? '1' : '0'; break;
+            default:               s[i] = (i == 0 || (alea64() & 1)) ? '1' : '0'; break;
+        }
+    }
+    s[bits] = '\0';
+    return s;
+}
+
+/* ===========================================================
+ *  Conversions et vérification
+ * =========================================================== */
+
+/* Écriture binaire d'un BigBinary ("0" pour zéro), via l'API publique (free) */
+static char *chaineBigBinary(const BigBinary A) {
+    int bits = BigBinary_nbBits(A);
+    if (bits == 0) {
+        char *z = (char*)malloc(2);
+        strcpy(z, "0");
+        return z;
+    }
+
+    size_t n = ((size_t)bits + 7) / 8;
+    unsigned char *o = (unsigned char*)malloc(n);
+    BigBinary_toBytes(A, o, n);
+
+    char *s = (char*)malloc((size_t)bits + 1);
+    for (int i = 0; i < bits; ++i) {
+        int pos = (int)(n * 8) - bits + i;   // bit depuis le poids fort
+        s[i] = (char)('0' + ((o[pos / 8] >> (7 - pos % 8)) & 1));
+    }
+    s[bits] = '\0';
+    free(o);
+    return s;
+}
+
+/* Compare et enregistre ; libère attendu et obtenu */
+static void verifier(const char *op, const char *a, const char *b,
+                     char *attendu, char *obtenu) {
+    nbVerifications++;
+    if (strcmp(attendu, obtenu) != 0) {
+        if (nbEchecs < ECHECS_AFFICHES) {
+            fprintf(stderr, "DIVERGENCE %s\n  a       = %s\n  b       = %s\n"
+                            "  attendu = %s\n  obtenu  = %s\n",
+                    op, a, b ? b : "-", attendu, obtenu);
+        }
+        nbEchecs++;
+    }
+    free(attendu);
+    free(obtenu);
+}
+
+/* Résultat entier (comparaisons) mis en chaîne pour verifier() */
+static char *chaineEntier(long v) {
+    char *s = (char*)malloc(24);
+    snprintf(s, 24, "%ld", v);
+    return s;
+}
+
+/* Mot de 64 bits mis en chaîne (hexadécimal) pour verifier() */
+static char *chaineMot(uint64_t v) {
+    char *s = (char*)malloc(20);
+    snprintf(s, 20, "%016llx", (unsigned long long)v);
+    return s;
+}
+
+/* Vérifie un résultat BigBinary contre un résultat de référence (les libère) */
+static void verifierRes(const char *op, const char *a, const char *b,
+                        RefBigBinary attendu, BigBinary obtenu) {
+    verifier(op, a, b, ref_versChaine(attendu), chaineBigBinary(obtenu));
+    ref_libere(&attendu);
+    libereBigBinary(&obtenu);
+}
+
+/* ===========================================================
+ *  Comparaison avec la référence
+ * =========================================================== */
+
+/* Bit i (0 = poids faible) de l'écriture binaire s, 0 au-delà */
+static int bitChaine(const char *s, size_t lg, size_t i) {
+    return i < lg && s[lg - 1 - i] == '1';
+}
+
+/* Écriture binaire sans zéros de tête des bits r[lg-1..0] (free) */
+static char *chaineBits(const char *r, size_t lg) {
+    size_t d = 0;
+    while (d + 1 < lg && r[d] == '0') d++;
+    char *s = (char*)malloc(lg - d + 2);
+    if (lg == 0) strcpy(s, "0");
+    else strcpy(s, r + d);
+    return s;
+}
+
+/* a op b sur les écritures binaires (op : '&', '|', '^') */
+static char *chaineLogique(const char *a, const char *b, char op) {
+    size_t la = strlen(a), lb = strlen(b), lg = la > lb ? la : lb;
+    char *r = (char*)malloc(lg + 1);
+    for (size_t i = 0; i < lg; ++i) {
+        int x = bitChaine(a, la, i), y = bitChaine(b, lb, i);
+        int v = op == '&' ? (x & y) : op == '|' ? (x | y) : (x ^ y);
+        r[lg - 1 - i] = (char)('0' + v);
+    }
+    r[lg] = '\0';
+    char *s = chaineBits(r, lg);
+    free(r);
+    return s;
+}
+
+/*
+ * Opérations bit à bit contre un calcul direct sur les chaînes : ET / OU /
+ * OU exclusif (copie et en place), complément, popcount, bits extrêmes,
+ * test / mise à un bit, extraction de fenêtre
+ */
+static void comparerBits(const char *a, const char *b, const BigBinary fa, const BigBinary fb) {
+    static const char OPS[3] = { '&', '|', '^' };
+    static const char *NOMS[3] = { "and", "or", "xor" };
+    size_t la = strlen(a);
+
+    for (int k = 0; k < 3; ++k) {
+        BigBinary R = OPS[k] == '&' ? BigBinary_and(fa, fb)
+                    : OPS[k] == '|' ? BigBinary_or(fa, fb) : BigBinary_xor(fa, fb);
+        verifier(NOMS[k], a, b, chaineLogique(a, b, OPS[k]), chaineBigBinary(R));
+        libereBigBinary(&R);
+
+        BigBinary P = copieBigBinary(fa);
+        if (OPS[k] == '&') BigBinary_andEnPlace(&P, fb);
+        else if (OPS[k] == '|') BigBinary_orEnPlace(&P, fb);
+        else BigBinary_xorEnPlace(&P, fb);
+        verifier(NOMS[k], a, b, chaineLogique(a, b, OPS[k]), chaineBigBinary(P));
+        libereBigBinary(&P);
+    }
+
+    // Complément sur une largeur plus petite ou plus grande que a
+    int bits = 1 + (int)(alea64() % (la + 70));
+    char *c = (char*)malloc((size_t)bits + 1);
+    for (int i = 0; i < bits; ++i) c[bits - 1 - i] = (char)('1' - bitChaine(a, la, (size_t)i));
+    c[bits] = '\0';
+    char nom[40];
+    snprintf(nom, sizeof(nom), "not(%d)", bits);
+    BigBinary N = BigBinary_not(fa, bits);
+    verifier(nom, a, NULL, chaineBits(c, (size_t)bits), chaineBigBinary(N));
+    BigBinary_notEnPlace(&N, bits);   // double complément : a tronqué à "bits" bits
+    for (int i = 0; i < bits; ++i) c[i] = (char)('1' - (c[i] - '0'));
+    verifier(nom, a, NULL, chaineBits(c, (size_t)bits), chaineBigBinary(N));
+    libereBigBinary(&N);
+    free(c);
+
+    // Comptage et bits extrêmes
+    int uns = 0, fort = -1, faible = -1;
+    for (size_t i = 0; i < la; ++i) {
+        if (!bitChaine(a, la, i)) continue;
+        uns++;
+        fort = (int)i;
+        if (faible < 0) faible = (int)i;
+    }
+    verifier("popcount", a, NULL, chaineEntier(uns), chaineEntier(BigBinary_popcount(fa)));
+    verifier("bitPoidsFort", a, NULL, chaineEntier(fort), chaineEntier(BigBinary_bitPoidsFort(fa)));
+    verifier("bitPoidsFaible", a, NULL, chaineEntier(faible),
+             chaineEntier(BigBinary_bitPoidsFaible(fa)));
+
+    // Un bit au hasard (parfois au-delà de a) : test, puis inversion par setBit
+    int i = (int)(alea64() % (la + 130));
+    int v = bitChaine(a, la, (size_t)i);
+    verifier("testBit", a, NULL, chaineEntier(v), chaineEntier(BigBinary_testBit(fa, i)));
+    char *p = (char*)malloc((size_t)i + 2);   // 2^i
+    p[0] = '1';
+    memset(p + 1, '0', (size_t)i);
+    p[i + 1] = '\0';
+    BigBinary S = copieBigBinary(fa);
+    BigBinary_setBit(&S, i, !v);
+    verifier("setBit", a, NULL, chaineLogique(a, p, '^'), chaineBigBinary(S));
+    BigBinary_setBit(&S, i, v);
+    verifier("setBit", a, NULL, chaineBigBinary(fa), chaineBigBinary(S));
+    libereBigBinary(&S);
+    free(p);
+
+    // Fenêtre de k ≤ 64 bits à une position quelconque
+    int k = 1 + (int)(alea64() % 64), bas = (int)(alea64() % (la + 8));
+    unsigned long long f = 0;
+    for (int j = k - 1; j >= 0; --j) f = (f << 1) | (unsigned long long)bitChaine(a, la, (size_t)(bas + j));
+    snprintf(nom, sizeof(nom), "extraireBits(%d, %d)", bas, k);
+    verifier(nom, a, NULL, chaineMot(f), chaineMot(BigBinary_extraireBits(fa, bas, k)));
+}
+
+/* Toutes les opérations à deux opérandes (hors expMod) sur a et b */
+static void comparerPaire(const char *a, const char *b) {
+    RefBigBinary ra = ref_initFromString(a), rb = ref_initFromString(b);
+    BigBinary fa = initBigBinaryFromString(a), fb = initBigBinaryFromString(b);
+
+    // Comparaisons
+    verifier("Egal", a, b, chaineEntier(ref_egal(ra, rb)), chaineEntier(Egal(fa, fb)));
+    verifier("Inferieur", a, b, chaineEntier(ref_inferieur(ra, rb)),
+             chaineEntier(Inferieur(fa, fb)));
+    verifier("Inferieur", b, a, chaineEntier(ref_inferieur(rb, ra)),
+             chaineEntier(Inferieur(fb, fa)));
+    int attenduCmp = ref_inferieur(ra, rb) ? -1 : !ref_egal(ra, rb);
+    verifier("BigBinary_cmp", a, b, chaineEntier(attenduCmp), chaineEntier(BigBinary_cmp(fa, fb)));
+    verifier("estZero", a, NULL, chaineEntier(ref_estZero(ra)), chaineEntier(estZero(fa)));
+    verifier("estPair", a, NULL, chaineEntier(ref_estPair(ra)), chaineEntier(estPair(fa)));
+
+    // Addition et soustractions
+    verifierRes("addition", a, b, ref_addition(ra, rb), additionBigBinary(fa, fb));
+    verifierRes("soustractionAbsolue", a, b,
+                ref_soustractionAbsolue(ra, rb), soustractionAbsolue(fa, fb));
+    BigBinary ecart = copieBigBinary(fa);   // résultat écrit dans le stockage de A
+    int signe = BigBinary_subAbs(&ecart, ecart, fb);
+    verifier("BigBinary_subAbs/signe", a, b, chaineEntier(attenduCmp), chaineEntier(signe));
+    verifierRes("BigBinary_subAbs", a, b, ref_soustractionAbsolue(ra, rb), ecart);
+    if (!ref_inferieur(ra, rb))
+        verifierRes("soustraction", a, b, ref_soustraction(ra, rb), soustractionBigBinary(fa, fb));
+
+    // Décalages (copie et en place)
+    for (int i = 0; i < NB_DECALAGES + 1; ++i) {
+        int n = (i < NB_DECALAGES) ? DECALAGES[i] : (int)(alea64() % 600);
+        char nom[48];
+
+        snprintf(nom, sizeof(nom), "decaleGauche(%d)", n);
+        verifierRes(nom, a, NULL, ref_decaleGauche(ra, n), decaleGauche(fa, n));
+        snprintf(nom, sizeof(nom), "decaleDroite(%d)", n);
+        verifierRes(nom, a, NULL, ref_decaleDroite(ra, n), decaleDroite(fa, n));
+
+        BigBinary g = copieBigBinary(fa);
+        decaleGaucheEnPlace(&g, n);
+        snprintf(nom, sizeof(nom), "decaleGaucheEnPlace(%d)", n);
+        verifierRes(nom, a, NULL, ref_decaleGauche(ra, n), g);
+
+        BigBinary d = copieBigBinary(fa);
+        decaleDroiteEnPlace(&d, n);
+        snprintf(nom, sizeof(nom), "decaleDroiteEnPlace(%d)", n);
+        verifierRes(nom, a, NULL, ref_decaleDroite(ra, n), d);
+    }
+
+    // Modulo et PGCD
+    if (!ref_estZero(rb))
+        verifierRes("mod", a, b, ref_mod(ra, rb), BigBinary_mod(fa, fb));
+    verifierRes("pgcd", a, b, ref_pgcd(ra, rb), pgcdBinaire(fa, fb));
+
+    // Opérations bit à bit
+    comparerBits(a, b, fa, fb);
+
+    // Racines : x^k exact (expMod sous un module plus grand que x^k), puis voisins
+    if (!estZero(fa)) {
+        int k = 2 + (int)(alea64() % 3);
+        BigBinary un = initBigBinaryFromString("1");
+        BigBinary module = decaleGauche(un, k * BigBinary_nbBits(fa) + 1);
+        BigBinary ek = initBigBinaryFromString(k == 2 ? "10" : k == 3 ? "11" : "100");
+        BigBinary p = BigBinary_expMod(fa, ek, module);
+        BigBinary pm1 = soustractionBigBinary(p, un), pPlus = additionBigBinary(p, fa);
+        BigBinary xm1 = soustractionBigBinary(fa, un);
+        BigBinary r[3] = { BigBinary_iroot(p, k), BigBinary_iroot(pm1, k), BigBinary_iroot(pPlus, k) };
+        verifier("iroot", a, NULL, chaineBigBinary(fa), chaineBigBinary(r[0]));
+        verifier("iroot(x^k - 1)", a, NULL, chaineBigBinary(xm1), chaineBigBinary(r[1]));
+        verifier("iroot(x^k + x)", a, NULL, chaineBigBinary(fa), chaineBigBinary(r[2]));
+        for (int i = 0; i < 3; ++i) libereBigBinary(&r[i]);
+        libereBigBinary(&un); libereBigBinary(&module); libereBigBinary(&ek);
+        libereBigBinary(&p); libereBigBinary(&pm1); libereBigBinary(&pPlus); libereBigBinary(&xm1);
+    }
+
+    ref_libere(&ra); ref_libere(&rb);
+    libereBigBinary(&fa); libereBigBinary(&fb);
+}
+
+/* M^E mod N, plus chiffrement / déchiffrement RSA (même calcul) */
+static void comparerExpMod(const char *m, const char *e, const char *n) {
+    RefBigBinary rm = ref_initFromString(m), re = ref_initFromString(e);
+    RefBigBinary rn = ref_initFromString(n);
+    BigBinary fm = initBigBinaryFromString(m), fe = initBigBinaryFromString(e);
+    BigBinary fn = initBigBinaryFromString(n);
+
+    if (!ref_estZero(rn)) {
+        verifierRes("expMod", m, n, ref_expMod(rm, re, rn), BigBinary_expMod(fm, fe, fn));
+        verifierRes("RSA_encrypt", m, n, ref_expMod(rm, re, rn),
+                    BigBinary_RSA_encrypt(fm, fe, fn));
+        verifierRes("RSA_decrypt", m, n, ref_expMod(rm, re, rn),
+                    BigBinary_RSA_decrypt(fm, fe, fn));
+
+        // m^e · (m² mod n)^e' · m^0 = m^(e + 2e'), avec e' = e >> 3
+        RefBigBinary re2 = ref_decaleDroite(re, 3);
+        RefBigBinary s1 = ref_addition(re, re2), s2 = ref_addition(s1, re2);
+        BigBinary deux = initBigBinaryFromString("10"), zero = initBigBinary();
+        BigBinary bases[3] = { fm, BigBinary_expMod(fm, deux, fn), fm };
+        BigBinary exps[3] = { fe, decaleDroite(fe, 3), zero };
+        verifierRes("multiExpMod", m, n, ref_expMod(rm, s2, rn),
+                    BigBinary_multiExpMod(bases, exps, 3, fn));
+        libereBigBinary(&bases[1]); libereBigBinary(&exps[1]);
+        libereBigBinary(&deux); libereBigBinary(&zero);
+        ref_libere(&re2); ref_libere(&s1); ref_libere(&s2);
+
+        // Base fixe : peigne de géométrie aléatoire, parfois trop court (repli)
+        int bitsE = BigBinary_nbBits(fe) - (int)(alea64() % 3);
+        BigBinaryFixedBase *G = BigBinaryFixedBase_creer(fm, fn, bitsE, 1 + (int)(alea64() % 5),
+                                                         1 + (int)(alea64() % 3));
+        verifierRes("BigBinaryFixedBase_expMod", m, n, ref_expMod(rm, re, rn),
+                    BigBinaryFixedBase_expMod(G, fe));
+        BigBinaryFixedBase_detruire(G);
+    }
+
+    ref_libere(&rm); ref_libere(&re); ref_libere(&rn);
+    libereBigBinary(&fm); libereBigBinary(&fe); libereBigBinary(&fn);
+}
+
+/* k messages, même exposant et même module, avec le moteur de lots actif */
+static void comparerExpModLot(int k, int bits) {
+    char *e = tirerChaine(1 + (int)(alea64() % (unsigned)bits), FORME_ALEATOIRE);
+    char *n = tirerChaine(bits, FORME_ALEATOIRE);
+    n[strlen(n) - 1] = '1';   // module impair : seul cas vectorisé
+
+    RefBigBinary re = ref_initFromString(e), rn = ref_initFromString(n);
+    BigBinary fe = initBigBinaryFromString(e), fn = initBigBinaryFromString(n);
+    char **m = (char**)malloc((size_t)k * sizeof(char*));
+    BigBinary *fm = (BigBinary*)malloc((size_t)k * sizeof(BigBinary));
+    BigBinary *res = (BigBinary*)malloc((size_t)k * sizeof(BigBinary));
+
+    for (int i = 0; i < k; ++i) {
+        Forme f = (Forme)(alea64() % NB_FORMES);   // messages < N ou non, 0, 1...
+        m[i] = tirerChaine(1 + (int)(alea64() % (unsigned)(bits + 8)), f);
+        fm[i] = initBigBinaryFromString(m[i]);
+    }
+    BigBinary_expModLot(fm, res, k, fe, fn);
+
+    for (int i = 0; i < k; ++i) {
+        RefBigBinary rm = ref_initFromString(m[i]);
+        verifierRes(BigBinary_moteurLot(), m[i], n, ref_expMod(rm, re, rn), res[i]);
+        ref_libere(&rm);
+        libereBigBinary(&fm[i]);
+        free(m[i]);
+    }
+
+    free(m); free(fm); free(res);
+    ref_libere(&re); ref_libere(&rn);
+    libereBigBinary(&fe); libereBigBinary(&fn);
+    free(e); free(n);
+}
+
+/*
+ * Opérandes a, b et base m sur BITS bits, exposant e, module impair n.
+ * L'exposant de référence n'est calculé que si refExpMod (sinon
+ * BigBinary_expMod sert de référence).
+ */
+#define BB_DIFF_FIXE(BITS)                                                                  \
+static void comparerFixe##BITS(const char *a, const char *b, const char *m, const char *e, \
+                               const char *n, int refExpMod) {                             \
+    RefBigBinary ra = ref_initFromString(a), rb = ref_initFromString(b);                    \
+    BigBinary fa = initBigBinaryFromString(a), fb = initBigBinaryFromString(b);            \
+    BigBinary fm = initBigBinaryFromString(m), fe = initBigBinaryFromString(e);            \
+    BigBinary fn = initBigBinaryFromString(n);                                              \
+    BigBinary##BITS xa, xb, xm, xn, xr;                                                     \
+    BigBinary##BITS##Mont M;                                                                \
+    BigBinary##BITS##_depuisBigBinary(&xa, fa);                                             \
+    BigBinary##BITS##_depuisBigBinary(&xb, fb);                                             \
+    BigBinary##BITS##_depuisBigBinary(&xm, fm);                                             \
+    BigBinary##BITS##_depuisBigBinary(&xn, fn);                                             \
+                                                                                            \
+    int attendu = ref_egal(ra, rb) ? 0 : ref_inferieur(ra, rb) ? -1 : 1;                    \
+    verifier(#BITS "_cmp", a, b, chaineEntier(attendu),                                     \
+             chaineEntier(BigBinary##BITS##_cmp(&xa, &xb)));                                \
+    if (!BigBinary##BITS##_add(&xr, &xa, &xb))                                              \
+        verifierRes(#BITS "_add", a, b, ref_addition(ra, rb),                               \
+                    BigBinary##BITS##_versBigBinary(&xr));                                  \
+    if (attendu >= 0) {                                                                     \
+        BigBinary##BITS##_sub(&xr, &xa, &xb);                                               \
+        verifierRes(#BITS "_sub", a, b, ref_soustraction(ra, rb),                           \
+                    BigBinary##BITS##_versBigBinary(&xr));                                  \
+    }                                                                                       \
+                                                                                            \
+    BigBinary##BITS##_montPreparer(&M, &xn);                                                \
+    BigBinary##BITS##_expMod(&M, &xr, &xm, fe);                                             \
+    if (refExpMod) {                                                                        \
+        RefBigBinary rm = ref_initFromString(m), re = ref_initFromString(e);                \
+        RefBigBinary rn = ref_initFromString(n);                                            \
+        verifierRes(#BITS "_expMod", m, n, ref_expMod(rm, re, rn),                          \
+                    BigBinary##BITS##_versBigBinary(&xr));                                  \
+        ref_libere(&rm); ref_libere(&re); ref_libere(&rn);                                  \
+    } else {                                                                                \
+        BigBinary r = BigBinary##BITS##_versBigBinary(&xr);                                 \
+        BigBinary attenduExp = BigBinary_expMod(fm, fe, fn);                                \
+        verifier(#BITS "_expMod", m, n, chaineBigBinary(attenduExp), chaineBigBinary(r));   \
+        libereBigBinary(&r); libereBigBinary(&attenduExp);                                  \
+    }                                                                                       \
+                                                                                            \
+    ref_libere(&ra); ref_libere(&rb);                                                       \
+    libereBigBinary(&fa); libereBigBinary(&fb); libereBigBinary(&fm);                       \
+    libereBigBinary(&fe); libereBigBinary(&fn);                                             \
+}
+
+BB_DIFF_FIXE(256)
+BB_DIFF_FIXE(512)
+BB_DIFF_FIXE(1024)
+BB_DIFF_FIXE(2048)
+BB_DIFF_FIXE(4096)
+
+/* Tire les opérandes d'un test de largeur fixe (module impair, souvent plus court) */
+static void comparerFixe(int bits, int bitsExp,
+                         void (*comparer)(const char *, const char *, const char *,
+                                          const char *, const char *, int)) {
+    int ta = 1 + (int)(alea64() % (unsigned)bits);
+    char *a = tirerChaine(alea64() & 1 ? bits : ta, (Forme)(alea64() % NB_FORMES));
+    char *b = tirerChaine(alea64() & 1 ? bits : ta, (Forme)(alea64() % NB_FORMES));
+    char *m = tirerChaine(bits, (Forme)(alea64() % NB_FORMES));
+    char *e = tirerChaine(bitsExp, FORME_ALEATOIRE);
+    char *n = tirerChaine(alea64() & 1 ? bits : 2 + (int)(alea64() % (unsigned)(bits - 1)),
+                          FORME_ALEATOIRE);
+    n[strlen(n) - 1] = '1';
+    comparer(a, b, m, e, n, bits <= 512);
+    free(a); free(b); free(m); free(e); free(n);
+}
+
+/* ===========================================================
+ *  Contrôle indépendant sur 64 bits (unsigned __int128)
+ * =========================================================== */
+
+#ifdef __SIZEOF_INT128__
+
+typedef unsigned __int128 u128;
+
+static char *chaineU128(u128 v) {
+    char tmp[130];
+    int n = 0;
+    do {
+        tmp[n++] = (char)('0' + (int)(v & 1));
+        v >>= 1;
+    } while (v != 0);
+
+    char *s = (char*)malloc((size_t)n + 1);
+    for (int i = 0; i < n; ++i) s[i] = tmp[n - 1 - i];
+    s[n] = '\0';
+    return s;
+}
+
+/* Entier signé : "-" suivi de la valeur absolue, comme afficheBigBinary */
+static char *chaineI128(__int128 v) {
+    if (v >= 0) return chaineU128((u128)v);
+    char *m = chaineU128((u128)(-v));
+    char *s = (char*)malloc(strlen(m) + 2);
+    s[0] = '-';
+    strcpy(s + 1, m);
+    free(m);
+    return s;
+}
+
+/* Écriture signée d'un BigBinary */
+static char *chaineSignee(const BigBinary A) {
+    char *m = chaineBigBinary(A);
+    if (!A.Signe) return m;
+    char *s = (char*)malloc(strlen(m) + 2);
+    s[0] = '-';
+    strcpy(s + 1, m);
+    free(m);
+    return s;
+}
+
+static uint64_t pgcdU64(uint64_t a, uint64_t b) {
+    while (b != 0) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+static uint64_t expModU64(uint64_t m, uint64_t e, uint64_t n) {
+    if (n == 1) return 0;
+    u128 r = 1, b = m % n;
+    while (e != 0) {
+        if (e & 1) r = (r * b) % n;
+        b = (b * b) % n;
+        e >>= 1;
+    }
+    return (uint64_t)r;
+}
+
+/* Jacobi par réciprocité et divisions (b impair) : indépendant de la boucle binaire */
+static int jacobiU64(uint64_t a, uint64_t b) {
+    int t = 1;
+    a %= b;
+    while (a != 0) {
+        while ((a & 1) == 0) {
+            a >>= 1;
+            if ((b & 7) == 3 || (b & 7) == 5) t = -t;
+        }
+        uint64_t c = a;
+        a = b;
+        b = c;
+        if ((a & 3) == 3 && (b & 3) == 3) t = -t;
+        a %= b;
+    }
+    return b == 1 ? t : 0;
+}
+
+static void comparerU128(uint64_t a, uint64_t b, uint64_t e) {
+    char *sa = chaineU128(a), *sb = chaineU128(b), *se = chaineU128(e);
+    BigBinary fa = initBigBinaryFromString(sa), fb = initBigBinaryFromString(sb);
+    BigBinary fe = initBigBinaryFromString(se);
+    BigBinary r;
+
+    r = additionBigBinary(fa, fb);
+    verifier("addition/int128", sa, sb, chaineU128((u128)a + b), chaineBigBinary(r));
+    libereBigBinary(&r);
+
+    r = soustractionAbsolue(fa, fb);
+    verifier("soustractionAbsolue/int128", sa, sb, chaineU128(a > b ? a - b : b - a),
+             chaineBigBinary(r));
+    libereBigBinary(&r);
+
+    int n = (int)(e % 65);   // a < 2^64 : le résultat tient sur 128 bits
+    r = decaleGauche(fa, n);
+    verifier("decaleGauche/int128", sa, se, chaineU128((u128)a << n), chaineBigBinary(r));
+    libereBigBinary(&r);
+
+    // Arithmétique signée : signes tirés dans les bits de e
+    __int128 va = (e & 2) ? -(__int128)a : (__int128)a;
+    __int128 vb = (e & 4) ? -(__int128)b : (__int128)b;
+    char *ta = chaineI128(va), *tb = chaineI128(vb);
+    BigBinary ga = initBigBinaryFromString(ta), gb = initBigBinaryFromString(tb);
+
+    r = BigBinary_additionSignee(ga, gb);
+    verifier("additionSignee/int128", ta, tb, chaineI128(va + vb), chaineSignee(r));
+    libereBigBinary(&r);
+    r = BigBinary_soustractionSignee(ga, gb);
+    verifier("soustractionSignee/int128", ta, tb, chaineI128(va - vb), chaineSignee(r));
+    libereBigBinary(&r);
+    verifier("compareSigne/int128", ta, tb, chaineEntier((va > vb) - (va < vb)),
+             chaineEntier(BigBinary_compareSigne(ga, gb)));
+    r = BigBinary_decaleDroiteSigne(ga, n);
+    verifier("decaleDroiteSigne/int128", ta, se, chaineI128(va >> n), chaineSignee(r));
+    libereBigBinary(&r);
+    if (b & 1) {
+        int j = jacobiU64(a, b) * ((va < 0 && (b & 3) == 3) ? -1 : 1);
+        verifier("jacobi/int128", ta, sb, chaineEntier(j), chaineEntier(BigBinary_jacobi(ga, fb)));
+    }
+
+    libereBigBinary(&ga); libereBigBinary(&gb);
+    free(ta); free(tb);
+
+    r = pgcdBinaire(fa, fb);
+    verifier("pgcd/int128", sa, sb, chaineU128(pgcdU64(a, b)), chaineBigBinary(r));
+    libereBigBinary(&r);
+
+    if (b != 0) {
+        r = BigBinary_mod(fa, fb);
+        verifier("mod/int128", sa, sb, chaineU128(a % b), chaineBigBinary(r));
+        libereBigBinary(&r);
+
+        r = BigBinary_expMod(fa, fe, fb);
+        verifier("expMod/int128", sa, sb, chaineU128(expModU64(a, e, b)), chaineBigBinary(r));
+        libereBigBinary(&r);
+
+        // Inverse : existe ⇔ pgcd = 1, et a·x ≡ 1 avec x < b
+        r = initBigBinary();
+        int inversible = BigBinary_modInverse(fa, fb, &r);
+        verifier("modInverse/existence", sa, sb, chaineEntier(pgcdU64(a, b) == 1),
+                 chaineEntier(inversible));
+        if (inversible) {
+            char *sx = chaineBigBinary(r);
+            uint64_t x = strtoull(sx, NULL, 2);
+            free(sx);
+            int ok = x < b || b == 1;
+            verifier("modInverse/produit", sa, sb, chaineU128(1 % b),
+                     chaineU128(ok ? (uint64_t)(((u128)a * x) % b) : b));
+        }
+        libereBigBinary(&r);
+    }
+
+    libereBigBinary(&fa); libereBigBinary(&fb); libereBigBinary(&fe);
+    free(sa); free(sb); free(se);
+}
+
+/* Valeur de 0 à 64 bits : les petites tailles reviennent souvent */
+static uint64_t alea64Taille(void) {
+    int bits = (int)(alea64() % 65);
+    if (bits == 0) return 0;
+    uint64_t v = alea64();
+    return bits == 64 ? v : (v & ((1ULL << bits) - 1)) | (1ULL << (bits - 1));
+}
+
+#endif /* __SIZEOF_INT128__ */
+
+/*
+ * Modules construits pour l'audit (série 6) :
+ *   - p et q de 256 bits distants de ~2^100 (Fermat) ;
+ *   - facteur premier sûr de 22 bits, p = 2r + 1 (rho, pas p − 1) ;
+ *   - p − 1 produit de premiers distincts < 2000 (p − 1) ;
+ *   - un premier de 127 bits (aucun facteur à trouver).
+ */
+static const char *MODULES_FAIBLES[] = {
+    "11000110000011010101110010101100011101110110000110100010111111001000001110110011010110011100011011101000100000111000010001001011100100111011101111010011111101110000000000011100010100011010000000101110110010011110100010000111010100001101011110001010010100100110101110111011101001000110110110011101101100010110011111100010110100010111100111110010100111111001100100100000101101011001110011001010111111000010010011011000001101101010100111101111100011000011101011111010100110011111100001110011111101000101111000000001",
+    "1010110001000001000001100101010000010000111010011011001100000010101001111010000001100000010011011110100000111001010111001110011001010001001001001000010110110101101010111101110011110001011100101100110111000101110011001000100011001010100101101010011101100000010101010011000001011110110101100111011010011111001000101100011001",
+    "10011111000001100100111000000100011101100001001111000010100001111100111010111110101101111011000110001110001001010000111010100000110000111001110001101001011001000010111000010010101110100111101010011111000000101110010000000000111000010000111001100110011101100001110101110000111011000100010101011110111001001000001111111000011010111010011110110111101100111111111100001100000111111000000110110010001100000100100100010010101010011001100110010001110011000010101111000011100101010110001110011000000001101110100100111110100111110010010110100111001000110110011110010110101101010001011010111011011110010000111111101011110001011",
+    "1001110011100001001111110101110000000110011010100101111000110110010110010111001011100100101101111010110100011111001110111000101",
+};
+static const BigBinaryMethodeFact METHODES_ATTENDUES[] = {
+    BB_FACT_FERMAT, BB_FACT_RHO, BB_FACT_PM1, BB_FACT_AUCUNE
+};
+#define NB_MODULES_FAIBLES 4
+
+/* Audit parallèle : bonne méthode, facteur strictement entre 1 et N qui divise N */
+static void comparerAudit(void) {
+    BigBinary N[NB_MODULES_FAIBLES];
+    BigBinaryAudit res[NB_MODULES_FAIBLES];
+    BigBinaryBudget budget = { 20000, 0 };
+    for (int i = 0; i < NB_MODULES_FAIBLES; ++i) N[i] = initBigBinaryFromString(MODULES_FAIBLES[i]);
+
+    BigBinary_auditerModules(N, res, NB_MODULES_FAIBLES, &budget, 2);
+    for (int i = 0; i < NB_MODULES_FAIBLES; ++i) {
+        verifier("audit/methode", MODULES_FAIBLES[i], NULL, chaineEntier(METHODES_ATTENDUES[i]),
+                 chaineEntier(res[i].methode));
+        if (res[i].methode != BB_FACT_AUCUNE) {
+            BigBinary r = BigBinary_mod(N[i], res[i].facteur);
+            int ok = estZero(r) && BigBinary_nbBits(res[i].facteur) > 1
+                     && BigBinary_cmp(res[i].facteur, N[i]) < 0;
+            verifier("audit/facteur", MODULES_FAIBLES[i], NULL, chaineEntier(1), chaineEntier(ok));
+            libereBigBinary(&r);
+        }
+        libereBigBinary(&res[i].facteur);
+        libereBigBinary(&N[i]);
+    }
+}
+
+/* p − 1 avec un budget taillé pour rho (2^40 pas) : B1 plafonné, pas de crible géant */
+static void comparerBudgetPm1(void) {
+    BigBinary N = initBigBinaryFromString(MODULES_FAIBLES[2]);
+    BigBinaryBudget budget = { 1LL << 40, 5.0 };
+    BigBinary f = initBigBinary();
+    int trouve = BigBinary_pollardPm1(N, &budget, &f);
+    verifier("pm1/budgetRho", MODULES_FAIBLES[2], NULL, chaineEntier(1), chaineEntier(trouve));
+    if (trouve) libereBigBinary(&f);
+    libereBigBinary(&N);
+}
+
+/*
+ * Premiers de la série 7, un par chemin de BigBinary_sqrtMod :
+ *   2^61 − 1 (≡ 3 mod 4), 2^64 − 59 (≡ 5 mod 8), 119·2^23 + 1,
+ *   le premier de 127 bits ci-dessus (≡ 5 mod 8), k·2^40 + 1 sur 198 bits.
+ */
+static const char *PREMIERS_RACINES[] = {
+    "1111111111111111111111111111111111111111111111111111111111111",
+    "1111111111111111111111111111111111111111111111111111111111000101",
+    "111011100000000000000000000001",
+    "1001110011100001001111110101110000000110011010100101111000110110010110010111001011100100101101111010110100011111001110111000101",
+    "101101101110011011010010111110000110100000001101101110110011011101010110111010000011110100011101001000110101101100001100000011010001110100110000001101000110110000000000000000000000000000000000000001",
+};
+#define NB_PREMIERS_RACINES 5
+
+/* sqrtMod : trouvé ⇔ (a / p) ≠ -1, r² ≡ a mod p, r ≤ p − r */
+static void comparerSqrtMod(const char *p, const char *a) {
+    BigBinary P = initBigBinaryFromString(p), A = initBigBinaryFromString(a);
+    BigBinary deux = initBigBinaryFromString("10");
+    BigBinary r = initBigBinary();
+
+    int attendu = BigBinary_jacobi(A, P) != -1;
+    int trouve = BigBinary_sqrtMod(A, P, &r);
+    verifier("sqrtMod/existence", a, p, chaineEntier(attendu), chaineEntier(trouve));
+    if (trouve) {
+        BigBinary carre = BigBinary_expMod(r, deux, P);
+        BigBinary am = BigBinary_mod(A, P);
+        BigBinary oppose = soustractionBigBinary(P, r);
+        verifier("sqrtMod/carre", a, p, chaineBigBinary(am), chaineBigBinary(carre));
+        verifier("sqrtMod/plusPetite", a, p, chaineEntier(1),
+                 chaineEntier(BigBinary_cmp(r, oppose) <= 0));
+        libereBigBinary(&carre); libereBigBinary(&am); libereBigBinary(&oppose);
+    }
+
+    libereBigBinary(&r); libereBigBinary(&deux);
+    libereBigBinary(&P); libereBigBinary(&A);
+}
+
+/* Lot de k inverses modulo un nombre de bits bits : chaque sortie = l'inverse seul */
+static void comparerInverseLot(int k, int bits, int avecNonInversible) {
+    char *m = tirerChaine(bits, FORME_ALEATOIRE);
+    BigBinary M = initBigBinaryFromString(m);
+    BigBinary xs[16], out[16];
+    char *sx[16];
+    for (int i = 0; i < k; ++i) {
+        sx[i] = tirerChaine(1 + (int)(alea64() % (bits + 8)), FORME_ALEATOIRE);
+        xs[i] = initBigBinaryFromString(sx[i]);
+    }
+    if (avecNonInversible) {   // multiple de M, ou M pair et x pair
+        libereBigBinary(&xs[k / 2]);
+        xs[k / 2] = estPair(M) ? initBigBinaryFromString("110") : decaleGauche(M, 1);
+    }
+
+    int attendus = 0;
+    int trouves = BigBinary_modInverse_batch(xs, k, M, out);
+    for (int i = 0; i < k; ++i) {
+        BigBinary r = initBigBinary();
+        attendus += BigBinary_modInverse(xs[i], M, &r);
+        verifier("modInverse_batch", sx[i], m, chaineBigBinary(r), chaineBigBinary(out[i]));
+        libereBigBinary(&r);
+        libereBigBinary(&out[i]);
+        libereBigBinary(&xs[i]);
+        free(sx[i]);
+    }
+    verifier("modInverse_batch/nombre", m, NULL, chaineEntier(attendus), chaineEntier(trouves));
+    libereBigBinary(&M);
+    free(m);
+}
+
+/*
+ * Vecteurs connus : xoshiro256** depuis l'état {1, 2, 3, 4} (code de
+ * référence des auteurs), ChaCha20 clé nulle, blocs 0 et 1 (RFC 8439, A.1)
+ */
+static void comparerAleaVecteurs(void) {
+    static const uint64_t XOSHIRO[4] = { 11520ULL, 0ULL, 1509978240ULL, 1215971899390074240ULL };
+    BigBinaryAlea g;
+    BigBinaryAlea_init(&g, BB_ALEA_XOSHIRO, 0);
+    for (int i = 0; i < 4; ++i) g.s[i] = (uint64_t)(i + 1);
+    for (int i = 0; i < 4; ++i)
+        verifier("alea/xoshiro256**", "{1,2,3,4}", NULL, chaineMot(XOSHIRO[i]),
+                 chaineMot(BigBinaryAlea_mot(&g)));
+
+    unsigned char cle[32] = { 0 };
+    BigBinaryAlea_initCle(&g, cle);
+    verifier("alea/chacha20", "bloc 0", NULL, chaineMot(0x903df1a0ade0b876ULL),
+             chaineMot(BigBinaryAlea_mot(&g)));
+    for (int i = 0; i < 7; ++i) BigBinaryAlea_mot(&g);
+    verifier("alea/chacha20", "bloc 1", NULL, chaineMot(0x7a385155bee7079fULL),
+             chaineMot(BigBinaryAlea_mot(&g)));
+}
+
+/*
+ * BigBinary_random contre les mêmes mots tirés un par un d'un générateur
+ * jumeau, et BigBinary_randomBelow(n) < n
+ */
+static void comparerAlea(BigBinaryAleaType type, uint64_t graine, int bits) {
+    BigBinaryAlea g1, g2;
+    BigBinaryAlea_init(&g1, type, graine);
+    BigBinaryAlea_init(&g2, type, graine);
+    char *sb = chaineEntier(bits);
+
+    size_t nm = ((size_t)bits + 63) / 64;
+    unsigned char *o = (unsigned char*)malloc(nm * 8);
+    for (size_t i = 0; i < nm; ++i) {
+        uint64_t v = BigBinaryAlea_mot(&g2);
+        if (i == nm - 1 && bits % 64) v &= (1ULL << (bits % 64)) - 1;
+        for (int k = 0; k < 8; ++k) o[(nm - 1 - i) * 8 + (7 - k)] = (unsigned char)(v >> (8 * k));
+    }
+    BigBinary attendu = initBigBinaryFromBytes(o, nm * 8);
+    BigBinary A = BigBinary_random(bits, &g1);
+    verifier("random", sb, NULL, chaineBigBinary(attendu), chaineBigBinary(A));
+    free(o);
+    libereBigBinary(&attendu);
+    libereBigBinary(&A);
+
+    char *n = tirerChaine(bits, (Forme)(alea64() % NB_FORMES));
+    BigBinary N = initBigBinaryFromString(n);
+    if (!estZero(N)) {
+        BigBinary B = BigBinary_randomBelow(N, &g1);
+        verifier("randomBelow", n, NULL, chaineEntier(-1), chaineEntier(BigBinary_cmp(B, N)));
+        libereBigBinary(&B);
+    }
+    libereBigBinary(&N);
+    free(n);
+    free(sb);
+}
+
+/* ===========================================================
+ *  Programme principal
+ * =========================================================== */
+
+static void usage(const char *prog) {
+    fprintf(stderr, "Usage : %s [--iterations N] [--max-bits N] [--seed N] [--noyaux nom]\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    int iterations = ITERATIONS_DEFAUT, maxBits = BITS_MAX_DEFAUT;
+
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        const char *a = argv[i], *v = argv[++i];
+        if (strcmp(a, "--iterations") == 0) iterations = atoi(v);
+        else if (strcmp(a, "--max-bits") == 0) maxBits = atoi(v);
+        else if (strcmp(a, "--seed") == 0) etatAlea = strtoull(v, NULL, 0) | 1ULL;
+        else if (strcmp(a, "--noyaux") == 0) {
+            int mots = BigBinary_choisirNoyaux(v), bits = BigBinary_choisirNoyauxBits(v);
+            if (!mots && !bits) {
+                fprintf(stderr, "Noyaux %s indisponibles sur ce CPU\n", v);
+                return 1;
+            }
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (maxBits < 2) maxBits = 2;
+
+    // SÉRIE 1 : cas limites (toutes les formes × tailles autour des seuils)
+    for (int t = 0; t < NB_TAILLES_LIMITES; ++t) {
+        int bits = TAILLES_LIMITES[t];
+        for (int fa = 0; fa < NB_FORMES; ++fa) {
+            for (int fb = 0; fb < NB_FORMES; ++fb) {
+                // b de taille voisine : égale, un peu plus petite, un peu plus grande
+                int tb = bits + (int)(alea64() % 3) - 1;
+                char *a = tirerChaine(bits, (Forme)fa);
+                char *b = tirerChaine(tb, (Forme)fb);
+                comparerPaire(a, b);
+                free(a); free(b);
+            }
+        }
+    }
+    for (int fm = 0; fm < NB_FORMES; ++fm) {
+        for (int fe = 0; fe < NB_FORMES; ++fe) {
+            for (int fn = 0; fn < NB_FORMES; ++fn) {
+                int bits = TAILLES_LIMITES[alea64() % NB_TAILLES_LIMITES];
+                if (bits > BITS_MAX_EXPMOD) bits = BITS_MAX_EXPMOD;
+                char *m = tirerChaine(bits + 8, (Forme)fm);
+                char *e = tirerChaine(1 + (int)(alea64() % bits), (Forme)fe);
+                char *n = tirerChaine(bits, (Forme)fn);
+                comparerExpMod(m, e, n);
+                free(m); free(e); free(n);
+            }
+        }
+    }
+
+    // SÉRIE 2 : opérandes aléatoires de tailles aléatoires
+    for (int it = 0; it < iterations; ++it) {
+        int ta = 1 + (int)(alea64() % (unsigned)maxBits);
+        int tb = 1 + (int)(alea64() % (unsigned)maxBits);
+        if (alea64() & 1) tb = 1 + (int)(alea64() % (unsigned)ta);   // diviseur plus court
+        char *a = tirerChaine(ta, FORME_ALEATOIRE);
+        char *b = tirerChaine(tb, FORME_ALEATOIRE);
+        comparerPaire(a, b);
+        free(a); free(b);
+
+        if (it % 4 == 0) {
+            int limite = maxBits < BITS_MAX_EXPMOD ? maxBits : BITS_MAX_EXPMOD;
+            int tn = 1 + (int)(alea64() % (unsigned)limite);
+            char *m = tirerChaine(1 + (int)(alea64() % (unsigned)(2 * tn)), FORME_ALEATOIRE);
+            char *e = tirerChaine(1 + (int)(alea64() % (unsigned)tn), FORME_ALEATOIRE);
+            char *n = tirerChaine(tn, FORME_ALEATOIRE);
+            comparerExpMod(m, e, n);
+            free(m); free(e); free(n);
+        }
+    }
+
+    // SÉRIE 3 : contrôle indépendant sur 64 bits
+#ifdef __SIZEOF_INT128__
+    for (int it = 0; it < 20 * iterations; ++it)
+        comparerU128(alea64Taille(), alea64Taille(), alea64Taille());
+#endif
+
+    // SÉRIE 4 : exponentiation par lots, chaque moteur disponible
+    static const char *MOTEURS[] = { "avx512ifma", "avx2", "scalaire" };
+    for (int i = 0; i < 3; ++i) {
+        if (!BigBinary_choisirMoteurLot(MOTEURS[i])) continue;
+        for (int it = 0; it < iterations / 10 + 1; ++it) {
+            int bits = 2 + (int)(alea64() % (BITS_MAX_EXPMOD - 1));
+            comparerExpModLot(1 + (int)(alea64() % 11), bits);
+        }
+    }
+
+    // SÉRIE 5 : types de largeur fixe
+    for (int it = 0; it < iterations / 10 + 1; ++it) {
+        comparerFixe(256, 1 + (int)(alea64() % 64), comparerFixe256);
+        comparerFixe(512, 1 + (int)(alea64() % 16), comparerFixe512);
+        comparerFixe(1024, 1 + (int)(alea64() % 256), comparerFixe1024);
+    }
+    for (int it = 0; it < iterations / 30 + 1; ++it) {
+        comparerFixe(2048, 1 + (int)(alea64() % 128), comparerFixe2048);
+        comparerFixe(4096, 1 + (int)(alea64() % 64), comparerFixe4096);
+    }
+
+    // SÉRIE 6 : audit des modules faibles
+    comparerAudit();
+    comparerBudgetPm1();
+
+    // SÉRIE 7 : racines carrées modulaires
+    for (int i = 0; i < NB_PREMIERS_RACINES; ++i) {
+        int bits = (int)strlen(PREMIERS_RACINES[i]);
+        for (int it = 0; it < iterations / 10 + 1; ++it) {
+            char *a = tirerChaine(1 + (int)(alea64() % (bits + 8)), FORME_ALEATOIRE);
+            comparerSqrtMod(PREMIERS_RACINES[i], a);
+            free(a);
+        }
+    }
+
+    // SÉRIE 8 : inverses modulaires par lots
+    for (int it = 0; it < iterations / 10 + 1; ++it) {
+        int bits = 2 + (int)(alea64() % (unsigned)(maxBits - 1));
+        comparerInverseLot(1 + (int)(alea64() % 16), bits, (int)(it & 1));
+    }
+
+    // SÉRIE 9 : générateurs pseudo-aléatoires
+    comparerAleaVecteurs();
+    for (int it = 0; it < iterations / 10 + 1; ++it) {
+        int bits = 1 + (int)(alea64() % (unsigned)maxBits);
+        comparerAlea((BigBinaryAleaType)(it & 1), alea64(), bits);
+    }
+
+    printf("%ld verifications, %ld divergence(s)\n", nbVerifications, nbEchecs);
+    return nbEchecs == 0 ? 0 : 1;
+}
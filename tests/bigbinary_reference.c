@@ -0,0 +1,1033 @@
+/*
+ * ============================================================================
+ * IMPLÉMENTATION DE RÉFÉRENCE (oracle du test différentiel)
+ * ============================================================================
+ *
+ * Copie de la bibliothèque d'origine : un int par bit, poids fort en premier,
+ * algorithmes bit à bit. Lente mais simple : elle sert uniquement à vérifier
+ * que les chemins rapides de bigbinary.c donnent les mêmes résultats.
+ *
+ * Seul écart avec l'original : ref_expMod parcourt directement les bits de
+ * l'exposant (plus de limite à 64 bits).
+ *
+ * ⚠️ Ne pas optimiser ce fichier : sa valeur vient de sa simplicité.
+ * ============================================================================
+ */
+
+#include "bigbinary_reference.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * normalizeBigBinary - Normalise un nombre binaire
+ *
+ * RÔLE : Cette fonction "nettoie" un RefBigBinary en :
+ *   1. Supprimant les zéros de tête (MSB = Most Significant Bit)
+ *   2. Gérant le cas spécial du zéro (un seul bit à 0)
+ *
+ * EXEMPLE : "00001101" devient "1101"
+ *           "00000000" devient "0"
+ *
+ *
+ * @param A : Pointeur vers le RefBigBinary à normaliser
+ */
+static void normalizeBigBinary(RefBigBinary *A) {
+    // Vérification de sécurité : pointeur NULL
+    if (A == NULL) return;
+
+    // CAS 1 : Structure vide ou invalide → transformer en zéro canonique
+    if (A->Tdigits == NULL || A->Taille <= 0) {
+        // Libère (par sécurité) l'ancien tableau, même si NULL
+        free(A->Tdigits);
+
+        // On réalloue un seul entier = 0
+        A->Tdigits = (int*)malloc(sizeof(int));
+        A->Tdigits[0] = 0;
+        A->Taille = 1;
+        A->Signe = 0;  // 0 est toujours positif
+        return;
+    }
+
+    // CAS 2 : Trouver le premier bit non nul (en partant du MSB/gauche)
+    // On cherche où commence vraiment le nombre
+    int i = 0;
+    while (i < A->Taille - 1 && A->Tdigits[i] == 0)
+        i++;
+
+    // CAS 3 : Si tous les bits sont à 0 → zéro canonique
+    if (i == A->Taille - 1 && A->Tdigits[i] == 0) {
+        // On libère et on force la représentation canonique
+        free(A->Tdigits);
+        A->Tdigits = (int*)malloc(sizeof(int));
+        A->Tdigits[0] = 0;
+        A->Taille = 1;
+        A->Signe = 0;
+        return;
+    }
+
+    // CAS 4 : Il y a des zéros de tête à supprimer
+    // Exemple : [0,0,1,0,1] → [1,0,1]
+    if (i > 0) {
+        int newLen = A->Taille - i;  // Nouvelle taille
+        int *nd = (int*)malloc(newLen * sizeof(int));
+
+        // Copier uniquement la partie utile (à partir de l'indice i)
+        memcpy(nd, A->Tdigits + i, newLen * sizeof(int));
+
+        // Libérer l'ancien tableau et utiliser le nouveau
+        free(A->Tdigits);
+
+        // met à jour la structure
+        A->Tdigits = nd;
+        A->Taille = newLen;
+    }
+
+    // CONVENTION : Le zéro est toujours positif (déjà géré ci-dessus)
+}
+
+/* ===========================================================
+ *  PHASE 1 — FONCTIONS DE BASE
+ *  Ces fonctions permettent de créer, afficher et manipuler
+ *  les RefBigBinary de manière élémentaire
+ * =========================================================== */
+
+/**
+ * ref_init - Crée un RefBigBinary valant zéro
+ *
+ * RÔLE : Initialise un nombre binaire à sa valeur par défaut : 0
+ *
+ * STRUCTURE RefBigBinary :
+ *   - Tdigits : tableau de bits (0 ou 1)
+ *   - Taille : nombre de bits
+ *   - Signe : 0 = positif, 1 = négatif
+ *
+ * @return : Un RefBigBinary représentant 0 (un seul bit à 0)
+ */
+RefBigBinary ref_init() {
+    RefBigBinary A;
+    A.Tdigits = (int*)malloc(sizeof(int));  // Alloue 1 int
+    A.Tdigits[0] = 0;                        // Met le bit à 0
+    A.Taille = 1;                            // Taille = 1 bit
+    A.Signe  = 0;                            // Positif
+    return A;
+}
+
+/**
+ * ref_initFromString - Crée un RefBigBinary depuis une chaîne binaire
+ *
+ * RÔLE : Convertit une chaîne de caractères (ex: "1011", "-101") en RefBigBinary
+ *
+ *
+ * @param str : Chaîne de caractères représentant le nombre binaire
+ * @return : RefBigBinary correspondant (ou 0 si erreur)
+ */
+RefBigBinary ref_initFromString(const char *str) {
+    // CAS 1 : Chaîne NULL ou vide → retourne 0
+    if (str == NULL || strlen(str) == 0) {
+        return ref_init();
+    }
+
+    // CAS 2 : Gérer les espaces et le signe optionnel
+    int signe = 0;   // 0 = positif, 1 = négatif
+    int i0 = 0;      // Indice de début après espaces et signe
+
+    // Sauter les espaces/tabs/newlines au début
+    while (str[i0] == ' ' || str[i0] == '\t' || str[i0] == '\n') i0++;
+
+    // Détecter le signe
+    if (str[i0] == '-') {
+        signe = 1;
+        i0++;
+    }
+    else if (str[i0] == '+') {
+        i0++;
+    }
+
+    // CAS 3 : Compter les chiffres binaires valides ('0' et '1')
+    int count = 0;
+    for (int i = i0; str[i] != '\0'; ++i) {
+        if (str[i] == '0' || str[i] == '1') {
+            count++;  // Chiffre binaire valide
+        }
+        else if (str[i] == ' ' || str[i] == '\t' || str[i] == '\n') {
+            continue;  // Espaces ignorés
+        }
+        else {
+            // Caractère invalide détecté
+            fprintf(stderr, "Erreur: caractère invalide '%c' dans la chaîne binaire\n", str[i]);
+            return ref_init();
+        }
+    }
+
+    // CAS 4 : Aucun chiffre valide → retourne 0
+    if (count == 0) {
+        return ref_init();
+    }
+
+    // CAS 5 : Créer le RefBigBinary avec les chiffres trouvés
+    RefBigBinary A;
+    A.Taille  = count;
+    A.Signe   = signe;
+    A.Tdigits = (int*)malloc(A.Taille * sizeof(int));
+
+    // Remplir le tableau avec les bits (0 ou 1)
+    int k = 0;
+    for (int i = i0; str[i] != '\0'; ++i) {
+        if (str[i] == '0' || str[i] == '1') {
+            A.Tdigits[k++] = (str[i] == '1') ? 1 : 0;
+        }
+    }
+
+    // Normaliser (supprimer les zéros de tête)
+    normalizeBigBinary(&A);
+    return A;
+}
+
+/**
+ * ref_affiche - Affiche un RefBigBinary sur la console
+ *
+ * RÔLE : Imprime le nombre binaire en format lisible
+ *
+ * FORMAT : [signe] + chiffres binaires + newline
+ * EXEMPLE : -1011\n pour -11₁₀
+ *
+ * @param A : Le RefBigBinary à afficher
+ */
+void ref_affiche(const RefBigBinary A) {
+    // Afficher le signe si négatif
+    if (A.Signe) printf("-");
+
+    // Afficher chaque bit
+    for (int i = 0; i < A.Taille; ++i) {
+        printf("%d", A.Tdigits[i]);
+    }
+    printf("\n");
+}
+
+/**
+ * ref_libere - Libère la mémoire d'un RefBigBinary
+ *
+ * RÔLE : Évite les fuites mémoire en libérant le tableau dynamique
+ *
+ * IMPORTANT : Après appel, le RefBigBinary ne doit plus être utilisé
+ *             (le tableau est libéré et pointeur mis à NULL)
+ *
+ * @param A : Pointeur vers le RefBigBinary à libérer
+ */
+void ref_libere(RefBigBinary *A) {
+    if (!A) return;  // Sécurité : pointeur NULL
+
+    // Libérer le tableau de bits
+    if (A->Tdigits) free(A->Tdigits);
+
+    // Réinitialiser la structure
+    A->Tdigits = NULL;
+    A->Taille  = 0;
+    A->Signe   = 0;
+}
+
+/**
+ * ref_egal - Teste l'égalité de deux RefBigBinary
+ *
+ * RÔLE : Vérifie si A == B (même valeur, même signe)
+ *
+ * PRÉCONDITION : Les RefBigBinary doivent être normalisés
+ *
+ * LOGIQUE :
+ *   1. Si tailles différentes → pas égaux
+ *   2. Si signes différents → pas égaux
+ *   3. Comparer bit par bit
+ *
+ * @param A, B : Les RefBigBinary à comparer
+ * @return : 1 si égaux, 0 sinon
+ */
+int ref_egal(const RefBigBinary A, const RefBigBinary B) {
+    // Test 1 : Tailles différentes
+    if (A.Taille != B.Taille) return 0;
+
+    // Test 2 : Signes différents
+    if (A.Signe  != B.Signe)  return 0;
+
+    // Test 3 : Comparer chaque bit
+    for (int i = 0; i < A.Taille; ++i) {
+        if (A.Tdigits[i] != B.Tdigits[i]) return 0;
+    }
+
+    return 1;  // Tous les tests passés → égaux
+}
+
+/**
+ * ref_inferieur - Teste si A < B (comparaison non signée)
+ *
+ * RÔLE : Compare deux nombres binaires comme des entiers positifs
+ *
+ * ALGORITHME :
+ *   1. Plus court → plus petit (101 < 1011)
+ *   2. Même taille → comparer bit par bit de gauche à droite (MSB first)
+ *
+ * EXEMPLE :
+ *   1010 < 1100 ? → compare MSB : 1==1, puis 0<1 → OUI
+ *   111 < 1000 ? → tailles : 3<4 → OUI
+ *
+ * @param A, B : Les RefBigBinary à comparer
+ * @return : 1 si A < B, 0 sinon
+ */
+int ref_inferieur(const RefBigBinary A, const RefBigBinary B) {
+    // Cas 1 : A a moins de bits → A < B
+    if (A.Taille < B.Taille) return 1;
+
+    // Cas 2 : A a plus de bits → A > B
+    if (A.Taille > B.Taille) return 0;
+
+    // Cas 3 : Même taille → comparer bit par bit (MSB first)
+    for (int i = 0; i < A.Taille; ++i) {
+        if (A.Tdigits[i] < B.Tdigits[i]) return 1;  // A < B
+        if (A.Tdigits[i] > B.Tdigits[i]) return 0;  // A > B
+    }
+
+    return 0;  // Égaux → A n'est pas < B
+}
+
+/**
+ * ref_addition - Addition de deux RefBigBinary
+ *
+ * RÔLE : Calcule A + B en binaire (comme addition de nombres positifs)
+ *
+ * ALGORITHME : Addition classique avec retenue (carry)
+ *   - Parcours de droite à gauche (LSB → MSB)
+ *   - À chaque position : bit_A + bit_B + retenue
+ *   - Si résultat ≥ 2 : on garde le bit de poids faible et propage la retenue
+ *
+ * EXEMPLE :
+ *     1011 (11)
+ *   + 0111 (7)
+ *   -------
+ *    10010 (18)
+ *
+ * DÉTAIL :
+ *   Position 0 (LSB) : 1+1+0 = 2 → bit=0, carry=1
+ *   Position 1       : 1+1+1 = 3 → bit=1, carry=1
+ *   Position 2       : 0+1+1 = 2 → bit=0, carry=1
+ *   Position 3       : 1+0+1 = 2 → bit=0, carry=1
+ *   Position 4 (MSB) : 0+0+1 = 1 → bit=1, carry=0
+ *
+ * @param A, B : Les RefBigBinary à additionner
+ * @return : Résultat A + B (normalisé)
+ */
+RefBigBinary ref_addition(const RefBigBinary A, const RefBigBinary B) {
+    // Déterminer la taille maximale
+    int n = (A.Taille > B.Taille) ? A.Taille : B.Taille;
+
+    // Créer le résultat (taille max + 1 pour la retenue finale)
+    RefBigBinary R;
+
+    // On ajoute 1 bit pour stocker une éventuelle retenue finale
+    R.Taille  = n + 1;
+    R.Signe   = 0;  // Non signé en Phase 1
+    R.Tdigits = (int*)calloc(R.Taille, sizeof(int));  // Initialise à 0
+
+    int carry = 0;  // Retenue initiale
+
+    // Boucle de droite à gauche (LSB → MSB)
+    for (int i = 0; i < n; ++i) {
+        // Récupérer le bit de A (ou 0 si hors bornes)
+        int abit = (A.Taille - 1 - i >= 0) ? A.Tdigits[A.Taille - 1 - i] : 0;
+
+        // Récupérer le bit de B (ou 0 si hors bornes)
+        int bbit = (B.Taille - 1 - i >= 0) ? B.Tdigits[B.Taille - 1 - i] : 0;
+
+        // Addition : bit_A + bit_B + retenue
+        int sum = abit + bbit + carry;
+
+        // Le bit résultat est le bit de poids faible de sum
+        R.Tdigits[R.Taille - 1 - i] = sum & 1;  // sum % 2
+
+        // La retenue est le bit de poids fort de sum
+        carry = (sum >> 1);  // sum / 2
+    }
+
+    // Placer la retenue finale (MSB)
+    R.Tdigits[0] = carry;
+
+    // Normaliser (supprimer les zéros de tête)
+    normalizeBigBinary(&R);
+    return R;
+}
+
+/* ===========================================================
+ *  Soustraction binaire
+ * =========================================================== */
+
+/**
+ * ref_soustraction - Soustraction A - B
+ *
+ * RÔLE : Calcule A - B en binaire
+ *
+ * PRÉCONDITION CRITIQUE : A >= B (sinon erreur)
+ *
+ * ALGORITHME : Soustraction classique avec emprunt (borrow)
+ *   - Parcours de droite à gauche (LSB → MSB)
+ *   - À chaque position : bit_A - bit_B - emprunt
+ *   - Si résultat < 0 : on emprunte 2 et propage l'emprunt
+ *
+ * EXEMPLE :
+ *     1011 (11)
+ *   - 0101 (5)
+ *   -------
+ *     0110 (6)
+ *
+ * DÉTAIL :
+ *   Position 0 (LSB) : 1-1-0 = 0 → bit=0, borrow=0
+ *   Position 1       : 1-0-0 = 1 → bit=1, borrow=0
+ *   Position 2       : 0-1-0 = -1 → bit=1 (0-1+2), borrow=1
+ *   Position 3       : 1-0-1 = 0 → bit=0, borrow=0
+ *
+ * @param A, B : Les RefBigBinary (A doit être >= B)
+ * @return : Résultat A - B (normalisé)
+ */
+RefBigBinary ref_soustraction(const RefBigBinary A, const RefBigBinary B) {
+    // VÉRIFICATION : A doit être >= B
+    if (ref_inferieur(A, B)) {
+        fprintf(stderr, "ERREUR: A < B dans ref_soustraction (précondition non respectée)\n");
+        return ref_init();  // Retourne 0 par défaut
+    }
+
+    // Créer le résultat (même taille que A)
+    RefBigBinary R;
+
+    // Le résultat ne peut pas être plus long que A
+    R.Taille  = A.Taille > 0 ? A.Taille : 1;   // au moins un bit (zéro)
+    R.Signe   = 0;  // Non signé en Phase 1
+    R.Tdigits = (int*)calloc((size_t)R.Taille, sizeof(int));  // Initialise à 0
+
+    int borrow = 0;  // Emprunt initial
+
+    // Boucle de droite à gauche (LSB → MSB)
+    for (int i = 0; i < A.Taille; ++i) {
+        // Bit de A
+        int abit = A.Tdigits[A.Taille - 1 - i];
+
+        // Bit de B (ou 0 si hors bornes)
+        int bbit = (B.Taille - 1 - i >= 0) ? B.Tdigits[B.Taille - 1 - i] : 0;
+
+        // Soustraction : bit_A - bit_B - emprunt
+        int diff = abit - bbit - borrow;
+
+        // Si diff < 0, on emprunte 2 (en binaire)
+        if (diff < 0) {
+            diff += 2;      // diff devient 0 ou 1
+            borrow = 1;     // Propagation de l'emprunt
+        }
+        else {
+            borrow = 0;     // Pas d'emprunt
+        }
+
+        // Placer le bit résultat
+        R.Tdigits[R.Taille - 1 - i] = diff;
+    }
+
+    // Normaliser (supprimer les zéros de tête)
+    normalizeBigBinary(&R);
+    return R;
+}
+
+/* ===========================================================
+ *  PHASE 2 — HELPERS & OPÉRATIONS ÉTENDUES
+ *  Fonctions avancées pour manipulation et algorithmes complexes
+ * =========================================================== */
+
+/**
+ * ref_estZero - Teste si un RefBigBinary vaut zéro
+ *
+ * RÔLE : Vérifie si tous les bits sont à 0
+ *
+ * @param A : Le RefBigBinary à tester
+ * @return : 1 si A == 0, 0 sinon
+ */
+int ref_estZero(const RefBigBinary A) {
+    // Parcourir tous les bits
+    for (int i = 0; i < A.Taille; ++i) {
+        if (A.Tdigits[i] != 0) return 0;  // Un bit non nul trouvé
+    }
+    return 1;  // Tous les bits sont à 0
+}
+
+/**
+ * ref_estPair - Teste si un RefBigBinary est pair
+ *
+ * RÔLE : Un nombre est pair si son dernier bit (LSB) est 0
+ *
+ * FORMAT MSB-FIRST : Le LSB est le dernier élément du tableau
+ *
+ * EXEMPLE :
+ *   1010 → LSB = 0 → pair
+ *   1011 → LSB = 1 → impair
+ *
+ * @param A : Le RefBigBinary à tester
+ * @return : 1 si pair, 0 si impair
+ */
+int ref_estPair(const RefBigBinary A) {
+    // Sécurité
+    if (A.Taille <= 0 || A.Tdigits == NULL) return 1;
+
+    // Le LSB est le dernier élément
+    return (A.Tdigits[A.Taille - 1] == 0);
+}
+
+/**
+ * ref_copie - Crée une copie profonde d'un RefBigBinary
+ *
+ * RÔLE : Clone complètement un RefBigBinary (nouveau tableau alloué)
+ *
+ * IMPORTANT : L'appelant doit libérer la copie avec ref_libere()
+ *
+ * @param A : Le RefBigBinary à copier
+ * @return : Une copie indépendante de A
+ */
+RefBigBinary ref_copie(const RefBigBinary A) {
+    RefBigBinary C;
+
+    C.Taille  = A.Taille;
+    C.Signe   = A.Signe;
+
+    // Allouer un nouveau tableau
+    C.Tdigits = (int*)malloc(C.Taille * sizeof(int));
+
+    // Copier tous les bits
+    memcpy(C.Tdigits, A.Tdigits, C.Taille * sizeof(int));
+
+    return C;
+}
+
+/**
+ * ref_decaleGauche - Décalage à gauche de n positions (multiplication par 2^n)
+ *
+ * RÔLE : Équivalent à multiplier par 2^n
+ *
+ * OPÉRATION : Ajoute n zéros à droite (côté LSB)
+ *
+ * EXEMPLE :
+ *   ref_decaleGauche(101, 2) = 10100
+ *   101₂ × 2² = 5 × 4 = 20 = 10100₂
+ *
+ * DANS LE TABLEAU MSB-FIRST :
+ *   [1,0,1] devient [1,0,1,0,0]
+ *
+ * @param A : Le RefBigBinary à décaler
+ * @param n : Nombre de positions (bits) de décalage
+ * @return : Résultat A << n (normalisé)
+ */
+RefBigBinary ref_decaleGauche(const RefBigBinary A, int n) {
+    // Cas triviaux : pas de décalage ou A = 0
+    if (n <= 0 || ref_estZero(A)) return ref_copie(A);
+
+    // Créer le résultat (taille augmentée de n)
+    RefBigBinary R;
+
+    // nouvelle taille = ancienne + n
+    R.Taille  = A.Taille + n;
+    R.Signe   = A.Signe;
+
+    // allocation
+    R.Tdigits = (int*)malloc(R.Taille * sizeof(int));
+
+    // Copier A au début (MSB)
+    memcpy(R.Tdigits, A.Tdigits, A.Taille * sizeof(int));
+
+    // Ajouter n zéros à la fin (LSB)
+    memset(R.Tdigits + A.Taille, 0, n * sizeof(int));
+
+    // nettoie
+    normalizeBigBinary(&R);
+    return R;
+}
+
+/**
+ * ref_decaleDroite - Décalage à droite de n positions (division par 2^n)
+ *
+ * RÔLE : Équivalent à diviser par 2^n (division entière)
+ *
+ * OPÉRATION : Supprime n bits à droite (côté LSB)
+ *
+ * EXEMPLE :
+ *   ref_decaleDroite(10110, 2) = 101
+ *   10110₂ ÷ 2² = 22 ÷ 4 = 5 = 101₂
+ *
+ * DANS LE TABLEAU MSB-FIRST :
+ *   [1,0,1,1,0] devient [1,0,1]
+ *
+ * @param A : Le RefBigBinary à décaler
+ * @param n : Nombre de positions (bits) de décalage
+ * @return : Résultat A >> n (normalisé)
+ */
+RefBigBinary ref_decaleDroite(const RefBigBinary A, int n) {
+    // Cas trivial : pas de décalage
+    if (n <= 0) return ref_copie(A);
+
+    // Si décalage >= taille → résultat = 0
+    if (n >= A.Taille) {
+        return ref_init();
+    }
+
+    // Créer le résultat (taille réduite de n)
+    RefBigBinary R;
+    R.Taille  = A.Taille - n;
+    R.Signe   = A.Signe;
+
+    // On alloue le tableau plus petit
+    R.Tdigits = (int*)malloc(R.Taille * sizeof(int));
+
+    // Copier uniquement la partie MSB (on supprime les n derniers bits)
+    memcpy(R.Tdigits, A.Tdigits, R.Taille * sizeof(int));
+
+    // On normalise
+    normalizeBigBinary(&R);
+    return R;
+}
+
+/**
+ * ref_soustractionAbsolue - Calcule |A - B| (valeur absolue)
+ *
+ * RÔLE : Soustraction sans se soucier de l'ordre
+ *
+ * LOGIQUE :
+ *   - Si A >= B → retourne A - B
+ *   - Si A < B → retourne B - A
+ *
+ * @param A, B : Les RefBigBinary
+ * @return : |A - B| (toujours positif)
+ */
+RefBigBinary ref_soustractionAbsolue(const RefBigBinary A, const RefBigBinary B) {
+    // Si A < B → on retourne (B - A)
+    if (ref_inferieur(A, B)) {
+        return ref_soustraction(B, A);  // B - A
+    } else {
+        return ref_soustraction(A, B);  // A - B
+    }
+}
+
+/**
+ * countTrailingZeros - Compte les zéros de fin (trailing zeros)
+ *
+ * RÔLE : Compte combien de zéros consécutifs il y a à droite (LSB)
+ *
+ * USAGE : Pour l'algorithme de Stein (PGCD binaire)
+ *
+ * EXEMPLE :
+ *   1011000 → 3 trailing zeros
+ *   1010101 → 0 trailing zeros
+ *
+ * @param A : Le RefBigBinary
+ * @return : Nombre de zéros de fin
+ */
+static int countTrailingZeros(const RefBigBinary A) {
+    int c = 0;
+    // Parcourir de droite à gauche (LSB → MSB)
+    for (int i = A.Taille - 1; i >= 0; --i) {
+        if (A.Tdigits[i] == 0) {
+            c++;  // Incrémenter le compteur
+        }
+        else {
+            break;  // Dès qu'on trouve un 1, on s'arrête
+        }
+    }
+    return c;
+}
+
+/**
+ * rshift1 - Décalage à droite d'une position (divise par 2)
+ *
+ * RÔLE : Helper pour simplifier le code (équivalent à A >> 1)
+ */
+static RefBigBinary rshift1(const RefBigBinary A) {
+    return ref_decaleDroite(A, 1);
+}
+
+/**
+ * lshiftK - Décalage à gauche de k positions (multiplie par 2^k)
+ *
+ * RÔLE : Helper pour simplifier le code (équivalent à A << k)
+ */
+static RefBigBinary lshiftK(const RefBigBinary A, int k) {
+    return ref_decaleGauche(A, k);
+}
+
+/**
+ * ref_pgcd - PGCD (Plus Grand Commun Diviseur) par l'algorithme de Stein
+ *
+ * RÔLE : Calcule le PGCD de deux nombres binaires efficacement
+ *
+ * ALGORITHME DE STEIN (algorithme binaire) :
+ *   C'est une alternative à l'algorithme d'Euclide, optimisée pour les ordinateurs
+ *   car elle n'utilise que des décalages, comparaisons et soustractions
+ *
+ * PRINCIPE :
+ *   1. Si X = 0 → PGCD = Y
+ *   2. Si Y = 0 → PGCD = X
+ *   3. Extraire les facteurs de 2 communs (trailing zeros)
+ *   4. Rendre X et Y impairs (diviser par 2 jusqu'à ce qu'impairs)
+ *   5. Boucle : soustraire le plus petit du plus grand, diviser par 2 si pair
+ *   6. Réappliquer les facteurs de 2 extraits au début
+ *
+ * EXEMPLE : PGCD(48, 18)
+ *   48 = 110000₂, 18 = 10010₂
+ *   Trailing zeros : 4 pour 48, 1 pour 18 → k=1 (minimum)
+ *   Après division : 1100 et 1001
+ *   ... itérations ...
+ *   Résultat × 2¹ = 6
+ *
+ * @param A, B : Les RefBigBinary
+ * @return : PGCD(A, B) (l'appelant doit libérer)
+ */
+RefBigBinary ref_pgcd(const RefBigBinary A, const RefBigBinary B) {
+    // ÉTAPE 1 : Créer des copies de travail (modifiables)
+    RefBigBinary X = ref_copie(A);
+    normalizeBigBinary(&X);
+    RefBigBinary Y = ref_copie(B);
+    normalizeBigBinary(&Y);
+
+    // ÉTAPE 2 : Cas de base
+    if (ref_estZero(X)) {
+        ref_libere(&X);
+        return Y;  // PGCD(0, Y) = Y
+    }
+    if (ref_estZero(Y)) {
+        ref_libere(&Y);
+        return X;  // PGCD(X, 0) = X
+    }
+
+    // ÉTAPE 3 : Extraire les facteurs de 2 communs
+    int kx = countTrailingZeros(X);  // X = X' × 2^kx
+    int ky = countTrailingZeros(Y);  // Y = Y' × 2^ky
+    int k  = (kx < ky) ? kx : ky;    // k = min(kx, ky)
+
+    // ÉTAPE 4 : Diviser X et Y par 2^kx et 2^ky (rendre impairs)
+    RefBigBinary t;
+    t = ref_decaleDroite(X, kx);
+    ref_libere(&X);
+    X = t;
+
+    t = ref_decaleDroite(Y, ky);
+    ref_libere(&Y);
+    Y = t;
+
+    // ÉTAPE 5 : Rendre X impair (sécurité, normalement déjà fait)
+    while (ref_estPair(X)) {
+        t = rshift1(X);
+        ref_libere(&X);
+        X = t;
+    }
+
+    // ÉTAPE 6 : Boucle principale de l'algorithme de Stein
+    while (!ref_estZero(Y)) {
+        // 6a. Rendre Y impair
+        while (ref_estPair(Y)) {
+            t = rshift1(Y);
+            ref_libere(&Y);
+            Y = t;
+        }
+
+        // 6b. S'assurer que X <= Y (échanger si nécessaire)
+        if (ref_inferieur(Y, X) == 0 && ref_egal(Y, X) == 0) {
+            // Y >= X et Y != X → Y > X
+            if (ref_inferieur(X, Y) == 0) {
+                // X >= Y → swap
+                RefBigBinary tmp = X;
+                X = Y;
+                Y = tmp;
+            }
+        } else if (ref_inferieur(X, Y) == 0) {
+            // X >= Y → swap
+            RefBigBinary tmp = X;
+            X = Y;
+            Y = tmp;
+        }
+
+        // 6c. Y = Y - X (deviendra pair, sera divisé par 2 au prochain tour)
+        t = ref_soustractionAbsolue(Y, X);
+        ref_libere(&Y);
+        Y = t;
+    }
+
+    // ÉTAPE 7 : Réappliquer les facteurs de 2 extraits (multiplier par 2^k)
+    RefBigBinary G = lshiftK(X, k);
+
+    // On libère X et Y (Y == 0)
+    ref_libere(&X);
+    ref_libere(&Y);
+
+    // Nettoyage
+    normalizeBigBinary(&G);
+    return G;
+}
+
+/**
+ * ref_mod - Calcule A modulo B (A mod B)
+ *
+ * RÔLE : Reste de la division de A par B
+ *
+ * ALGORITHME : Soustraction répétée avec alignement
+ *   On soustrait B décalé à gauche (B×2^k) tant que possible
+ *   pour se rapprocher rapidement de 0
+ *
+ * PRINCIPE :
+ *   1. Si A < B → résultat = A
+ *   2. Sinon, trouver le plus grand k tel que B×2^k <= A
+ *   3. Soustraire B×2^k de A
+ *   4. Répéter jusqu'à A < B
+ *
+ * EXEMPLE : 19 mod 5
+ *   19 = 10011₂, 5 = 101₂
+ *   k=2 : 5×4=10100₂ > 19 → non
+ *   k=1 : 5×2=1010₂ <= 19 → 19-10=1001₂ (9)
+ *   k=1 : 5×2=1010₂ > 9 → non
+ *   k=0 : 5×1=101₂ <= 9 → 9-5=100₂ (4)
+ *   Résultat : 4
+ *
+ * @param A : Le dividende
+ * @param B : Le diviseur (doit être > 0)
+ * @return : A mod B (normalisé)
+ */
+RefBigBinary ref_mod(const RefBigBinary A, const RefBigBinary B) {
+    // CAS 1 : Division par zéro
+    if (ref_estZero(B)) {
+        fprintf(stderr, "Erreur: modulo par zero\n");
+        return ref_init();
+    }
+
+    // CAS 2 : Copier A comme reste initial
+    RefBigBinary R = ref_copie(A);
+
+    // CAS 3 : Si A < B, le reste est déjà A
+    if (ref_inferieur(R, B)) return R;
+
+    // CAS 4 : Soustraction répétée avec alignement
+    int maxShift = R.Taille - B.Taille;  // Décalage maximum possible
+
+    for (int k = maxShift; k >= 0; --k) {
+        // Calculer B × 2^k
+        RefBigBinary Bk = ref_decaleGauche(B, k);
+
+        // Si R >= B×2^k, soustraire
+        if (!ref_inferieur(R, Bk)) {
+            RefBigBinary tmp = ref_soustraction(R, Bk);
+            ref_libere(&R);
+            R = tmp;
+        }
+
+        // Libère B<<k
+        ref_libere(&Bk);
+
+        // Optimisation : si R = 0, on peut arrêter
+        if (ref_estZero(R)) break;
+    }
+
+    return R;  // Normalisé par ref_soustraction
+}
+
+/**
+ * add_mod - Addition modulaire : (X + Y) mod mod
+ *
+ * RÔLE : Additionne puis prend le modulo (évite les débordements)
+ *
+ * @param X, Y : Opérandes
+ * @param mod : Le modulo
+ * @return : (X + Y) mod mod
+ */
+static RefBigBinary add_mod(const RefBigBinary X, const RefBigBinary Y, const RefBigBinary mod) {
+    // Addition binaire X + Y
+    RefBigBinary s = ref_addition(X, Y);
+
+    // On réduit modulo mod
+    RefBigBinary r = ref_mod(s, mod);
+
+    // Libère la somme intermédiaire
+    ref_libere(&s);
+    return r;
+}
+
+/**
+ * lshift1_mod - Décalage gauche modulaire : (X × 2) mod mod
+ *
+ * RÔLE : Multiplie par 2 puis prend le modulo
+ *
+ * @param X : Opérande
+ * @param mod : Le modulo
+ * @return : (X × 2) mod mod
+ */
+static RefBigBinary lshift1_mod(const RefBigBinary X, const RefBigBinary mod) {
+    // Décalage gauche → multiplie par 2
+    RefBigBinary d = ref_decaleGauche(X, 1);
+
+    // Réduction modulo mod
+    RefBigBinary r = ref_mod(d, mod);
+
+    // On libère le résultat du décalage non réduit
+    ref_libere(&d);
+
+    return r;
+}
+
+/**
+ * ref_mul_mod - Multiplication modulaire : (X × Y) mod mod
+ *
+ * RÔLE : Multiplie deux RefBigBinary modulo un troisième (sans débordement)
+ *
+ * ALGORITHME : Multiplication "schoolbook" par décalages et additions
+ *   C'est équivalent à la multiplication que l'on apprend à l'école,
+ *   mais en binaire et avec modulo à chaque étape
+ *
+ * PRINCIPE :
+ *   X × Y = X × (somme des bits de Y × leur poids en puissance de 2)
+ *
+ *   On traite Y bit par bit :
+ *   - Si bit = 1 : ajouter X décalé de la position du bit
+ *   - Puis décaler X d'une position (multiplier par 2)
+ *
+ * EXEMPLE : 5 × 3 mod 7
+ *   5 = 101₂, 3 = 11₂
+ *   res = 0, a = 5
+ *   bit 0 de 3 = 1 : res = (0 + 5) mod 7 = 5, a = (5×2) mod 7 = 3
+ *   bit 1 de 3 = 1 : res = (5 + 3) mod 7 = 1
+ *   Résultat : 1 (car 5×3 = 15 = 2×7 + 1)
+ *
+ * @param X, Y : Les opérandes
+ * @param mod : Le modulo
+ * @return : (X × Y) mod mod
+ */
+static RefBigBinary ref_mul_mod(const RefBigBinary X, const RefBigBinary Y, const RefBigBinary mod) {
+    // Initialisation
+    RefBigBinary a = ref_mod(X, mod);    // a = X mod mod
+    RefBigBinary b = ref_copie(Y);        // b = Y (sera divisé par 2 à chaque tour)
+    RefBigBinary res = ref_init();        // res = 0 (accumulateur)
+
+    // Boucle : tant que b != 0
+    while (!ref_estZero(b)) {
+        // Si b est impair (bit de poids faible = 1)
+        if (!ref_estPair(b)) {
+            // res = (res + a) mod mod
+            RefBigBinary tmp = add_mod(res, a, mod);
+
+            // remplace res = tmp
+            ref_libere(&res);
+            res = tmp;
+        }
+
+        // a = (a × 2) mod mod (décalage gauche)
+        RefBigBinary a2 = lshift1_mod(a, mod);
+        ref_libere(&a);
+        a = a2;
+
+        // b = b >> 1 (diviser par 2)
+        RefBigBinary b2 = ref_decaleDroite(b, 1);
+        ref_libere(&b);
+        b = b2;
+    }
+
+    // Nettoyage
+    ref_libere(&a);
+    ref_libere(&b);
+
+    return res;
+}
+
+/**
+ * ref_expMod - Exponentiation modulaire : (M^exp) mod mod
+ *
+ * RÔLE : Calcule M puissance exp modulo mod (TRÈS efficace)
+ *
+ * ALGORITHME : "Square-and-multiply" (carré et multiplie)
+ *   C'est l'algorithme standard pour les grandes exponentiations
+ *   (utilisé en cryptographie : RSA, Diffie-Hellman, etc.)
+ *
+ * PRINCIPE :
+ *   On décompose l'exposant en binaire :
+ *   exp = sum(bit_i × 2^i) pour i de 0 à n
+ *
+ *   Donc M^exp = M^(sum(bit_i × 2^i)) = produit(M^(2^i))^bit_i
+ *
+ *   À chaque étape :
+ *   - Si bit_i = 1 : multiplier le résultat par base^(2^i)
+ *   - base^(2^(i+1)) = (base^(2^i))² (d'où "square")
+ *
+ * EXEMPLE : 3^13 mod 7
+ *   13 = 1101₂
+ *   base = 3, result = 1
+ *
+ *   bit 0 = 1 : result = 1×3 = 3, base = 3² = 9 mod 7 = 2
+ *   bit 1 = 0 : base = 2² = 4
+ *   bit 2 = 1 : result = 3×4 = 12 mod 7 = 5, base = 4² = 16 mod 7 = 2
+ *   bit 3 = 1 : result = 5×2 = 10 mod 7 = 3
+ *
+ *   Résultat : 3 (vérif : 3^13 = 1594323 = 227760×7 + 3)
+ *
+ * COMPLEXITÉ : O(log(exp)) multiplications au lieu de O(exp)
+ *   Pour exp = 1000000, seulement ~20 opérations au lieu de 1000000 !
+ *
+ * @param M : La base
+ * @param exp : L'exposant (taille quelconque)
+ * @param mod : Le modulo
+ * @return : (M^exp) mod mod
+ */
+RefBigBinary ref_expMod(const RefBigBinary M, const RefBigBinary exp, const RefBigBinary mod) {
+    // CAS 1 : Modulo nul
+    if (ref_estZero(mod)) {
+        fprintf(stderr, "Erreur: mod nul dans expMod\n");
+        return ref_init();
+    }
+
+    // CAS 2 : Si mod == 1 → résultat toujours 0
+    RefBigBinary one = ref_initFromString("1");
+    RefBigBinary mod_eq_1 = ref_mod(one, mod);
+    if (ref_estZero(mod_eq_1)) {
+        ref_libere(&mod_eq_1);
+        ref_libere(&one);
+        return ref_init();
+    }
+    ref_libere(&mod_eq_1);
+
+    // ÉTAPE 1 : Initialisation
+    RefBigBinary base = ref_mod(M, mod);      // base = M mod mod
+    RefBigBinary result = ref_initFromString("1");  // result = 1
+
+    // ÉTAPE 2 : Boucle square-and-multiply (bits de exp, du LSB au MSB)
+    for (int i = exp.Taille - 1; i >= 0; --i) {
+        // Si le bit courant de exp est 1
+        if (exp.Tdigits[i]) {
+            // result = (result × base) mod mod
+            RefBigBinary tmp = ref_mul_mod(result, base, mod);
+            ref_libere(&result);
+            result = tmp;
+        }
+
+        // Si on n'a pas fini, calculer le carré de base
+        if (i > 0) {
+            // base = (base × base) mod mod
+            RefBigBinary sq = ref_mul_mod(base, base, mod);
+            ref_libere(&base);
+            base = sq;
+        }
+    }
+
+    ref_libere(&one);
+    ref_libere(&base);
+    return result;
+}
+
+/* ===========================================================
+ *  Conversion pour les comparaisons
+ * =========================================================== */
+
+/**
+ * ref_versChaine - Écriture binaire de A ("0" pour zéro)
+ *
+ * @param A : Le nombre (normalisé)
+ * @return : Chaîne allouée (à libérer avec free)
+ */
+char *ref_versChaine(const RefBigBinary A) {
+    char *s = (char*)malloc((size_t)A.Taille + 1);
+    for (int i = 0; i < A.Taille; ++i) s[i] = (char)('0' + A.Tdigits[i]);
+    s[A.Taille] = '\0';
+    return s;
+}
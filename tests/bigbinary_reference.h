@@ -0,0 +1,48 @@
+#ifndef BIGBINARY_REFERENCE_H
+#define BIGBINARY_REFERENCE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ===========================================================
+ *  IMPLÉMENTATION DE RÉFÉRENCE (bigbinary_reference.c)
+ * =========================================================== */
+
+/**
+ * RefBigBinary : représentation d'origine de la bibliothèque
+ *
+ * Sert d'oracle au test différentiel (bigbinary_diff.c) : chaque chemin
+ * rapide de bigbinary.c doit donner exactement les mêmes résultats.
+ */
+typedef struct {
+    int *Tdigits;  // 📌 Tableau de bits (0 ou 1), poids fort en premier
+    int Taille;    // 📌 Nombre de bits dans le tableau
+    int Signe;     // 📌 0 = positif (non signé en Phase 1)
+} RefBigBinary;
+
+// 🔹 INITIALISATION / LIBÉRATION
+RefBigBinary ref_init();
+RefBigBinary ref_initFromString(const char *str);
+void ref_affiche(const RefBigBinary A);
+void ref_libere(RefBigBinary *A);
+char *ref_versChaine(const RefBigBinary A);   // à libérer avec free
+
+// 🔹 COMPARAISONS
+int ref_egal(const RefBigBinary A, const RefBigBinary B);
+int ref_inferieur(const RefBigBinary A, const RefBigBinary B);
+int ref_estZero(const RefBigBinary A);
+int ref_estPair(const RefBigBinary A);
+
+// 🔹 OPÉRATIONS
+RefBigBinary ref_copie(const RefBigBinary A);
+RefBigBinary ref_addition(const RefBigBinary A, const RefBigBinary B);
+RefBigBinary ref_soustraction(const RefBigBinary A, const RefBigBinary B);
+RefBigBinary ref_soustractionAbsolue(const RefBigBinary A, const RefBigBinary B);
+RefBigBinary ref_decaleGauche(const RefBigBinary A, int n);
+RefBigBinary ref_decaleDroite(const RefBigBinary A, int n);
+RefBigBinary ref_pgcd(const RefBigBinary A, const RefBigBinary B);
+RefBigBinary ref_mod(const RefBigBinary A, const RefBigBinary B);
+RefBigBinary ref_expMod(const RefBigBinary M, const RefBigBinary exp, const RefBigBinary mod);
+
+#endif // BIGBINARY_REFERENCE_H
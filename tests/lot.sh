@@ -0,0 +1,55 @@
+#!/bin/sh
+#
+# Mode lot de projet_C avec plusieurs travailleurs : quelques milliers de
+# lignes (donc des dizaines de paquets en vol) dont des commandes en échec
+# et des commentaires. La sortie doit suivre l'ordre de l'entrée, ligne pour
+# ligne, avec "erreur ligne N : ..." au bon numéro et le code de sortie 1.
+# Puis un lot sans erreur (code 0) et une entrée introuvable (la sortie
+# existante ne doit pas être vidée).
+#
+# UTILISATION : lot.sh <projet_C>
+
+PROJET="$1"
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+
+# Entrée et sortie attendue : add i 1 en hexadécimal, avec une opération
+# inconnue toutes les 97 lignes, un module nul toutes les 211 et un
+# commentaire toutes les 500
+awk -v ENTREE="$DIR/entree" -v ATTENDU="$DIR/attendu" 'BEGIN {
+    for (i = 1; i <= 3000; i++) {
+        if (i % 500 == 0) {
+            print "# commentaire" > ENTREE
+        } else if (i % 97 == 0) {
+            print "mul 0x1 0x1" > ENTREE
+            print "erreur ligne " i " : operation inconnue" > ATTENDU
+        } else if (i % 211 == 0) {
+            print "mod 0x" sprintf("%x", i) " 0" > ENTREE
+            print "erreur ligne " i " : module nul" > ATTENDU
+        } else {
+            print "add 0x" sprintf("%x", i) " 0x1" > ENTREE
+            print "0x" sprintf("%x", i + 1) > ATTENDU
+        }
+    }
+}'
+
+"$PROJET" --lot "$DIR/entree" -o "$DIR/sortie" -t 4 --hex 2>/dev/null
+code=$?
+if [ "$code" -ne 1 ]; then
+    echo "code de sortie $code, 1 attendu" >&2
+    exit 1
+fi
+cmp "$DIR/attendu" "$DIR/sortie" || exit 1
+
+# Sans erreur : code 0, et lecture sur stdin
+grep -v -e '^mul' -e '^mod' "$DIR/entree" > "$DIR/propre"
+"$PROJET" --lot -t 4 --hex < "$DIR/propre" > "$DIR/sortie" || exit 1
+grep -v '^erreur' "$DIR/attendu" | cmp - "$DIR/sortie" || exit 1
+
+# Entrée introuvable : échec, et la sortie garde son contenu
+printf 'intact' > "$DIR/sortie"
+if "$PROJET" --lot "$DIR/absent" -o "$DIR/sortie" 2>/dev/null; then
+    exit 1
+fi
+[ "$(cat "$DIR/sortie")" = intact ] || exit 1
+exit 0
@@ -0,0 +1,53 @@
+#!/bin/sh
+#
+# Aller-retour de rsa_flux : chiffrement puis déchiffrement de fichiers de
+# 0 octet, un bloc moins un, exactement un bloc et plusieurs blocs (dont un
+# incomplet), comparés à l'original. Puis les cas d'erreur : sortie pleine
+# (/dev/full), entrée illisible (un répertoire : erreur de lecture, pas fin
+# de fichier) et entrée introuvable (la sortie existante ne doit pas être
+# vidée).
+# Clé : n = (2^61 − 1)(2^89 − 1) sur 150 bits → blocs clairs de 18 octets,
+# e = 65537.
+#
+# UTILISATION : rsa_flux.sh <rsa_flux>
+
+RSA="$1"
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+
+N=111111111111111111111111111111111111111111111111111111111111011111111111111111111111111110000000000000000000000000000000000000000000000000000000000001
+E=10000000000000001
+D=10000111111111110111100000000000100001111111111101110111111110000000100000000111111101110111000000001000100011111111011101110000000010001001
+
+for taille in 0 17 18 131 5000; do
+    head -c "$taille" /dev/urandom > "$DIR/clair"
+    "$RSA" chiffre -n "$N" -k "$E" -i "$DIR/clair" -o "$DIR/chiffre" -t 2 2>/dev/null || exit 1
+    "$RSA" dechiffre -n "$N" -k "$D" -i "$DIR/chiffre" -o "$DIR/retour" -t 2 2>/dev/null || exit 1
+    cmp "$DIR/clair" "$DIR/retour" || exit 1
+done
+
+# Écriture impossible : code de sortie non nul
+if [ -w /dev/full ]; then
+    if "$RSA" chiffre -n "$N" -k "$E" -i "$DIR/clair" -o /dev/full 2>/dev/null; then
+        echo "ecriture sur /dev/full acceptee" >&2
+        exit 1
+    fi
+fi
+
+# Entrée illisible : "lecture impossible", pas un chiffré tronqué accepté
+mkdir "$DIR/rep"
+for sens in chiffre dechiffre; do
+    if [ "$sens" = chiffre ]; then K="$E"; else K="$D"; fi
+    if "$RSA" "$sens" -n "$N" -k "$K" -i "$DIR/rep" -o "$DIR/illisible" 2>"$DIR/err"; then
+        echo "$sens : lecture d'un repertoire acceptee" >&2
+        exit 1
+    fi
+    grep -q "lecture impossible" "$DIR/err" || exit 1
+done
+
+# Entrée introuvable : échec, et la sortie garde son contenu
+printf 'intact' > "$DIR/sortie"
+if "$RSA" chiffre -n "$N" -k "$E" -i "$DIR/absent" -o "$DIR/sortie" 2>/dev/null; then
+    exit 1
+fi
+[ "$(cat "$DIR/sortie")" = intact ]
@@ -0,0 +1,93 @@
+#!/bin/sh
+#
+# Test de bout en bout du service local : bigbinary_serveur sur une socket
+# temporaire, requêtes envoyées par bigbinary_client, réponses comparées.
+# Ensuite :
+#   - quatre clients en parallèle sur la même clé, 2000 requêtes chacun :
+#     regroupement par clé et contre-pression (bien plus de requêtes en vol
+#     que EN_COURS_MAX), chaque client doit recevoir ses propres résultats ;
+#   - des clients tués avec leurs requêtes en vol (en file, en calcul,
+#     réponses à envoyer) : le serveur doit continuer à répondre aux autres
+#     et s'arrêter proprement sur SIGTERM.
+# Clé 3 : n = 61 × 53 = 3233, e = 17, d = 2753.
+#
+# UTILISATION : serveur_rpc.sh <bigbinary_serveur> <bigbinary_client>
+
+SERVEUR="$1"
+CLIENT="$2"
+DIR=$(mktemp -d)
+PID=
+trap '[ -n "$PID" ] && kill "$PID" 2>/dev/null; rm -rf "$DIR"' EXIT
+
+printf '3 110010100001 10001 101011000001\n' > "$DIR/cles"
+"$SERVEUR" -s "$DIR/sock" -k "$DIR/cles" -t 2 2>"$DIR/journal" &
+PID=$!
+i=0
+while [ ! -S "$DIR/sock" ] && [ $i -lt 50 ]; do
+    sleep 0.1
+    i=$((i + 1))
+done
+
+# rsa-enc 65, rsa-dec 2790, 4^13 mod 497, pgcd(48, 18), clé inconnue
+printf 'rsa-enc 3 1000001\nrsa-dec 3 101011100110\nexpmod 100 1101 111110001\ngcd 110000 10010\nrsa-dec 4 1\n' > "$DIR/requetes"
+printf '101011100110\n1000001\n110111101\n110\nerreur ligne 5 : cle inconnue\n' > "$DIR/attendu"
+"$CLIENT" -s "$DIR/sock" < "$DIR/requetes" > "$DIR/sortie" 2>/dev/null
+cmp "$DIR/attendu" "$DIR/sortie" || exit 1
+
+# Clients parallèles : rsa-enc et rsa-dec alternés sur des messages propres
+# à chaque client, résultats attendus calculés par awk (3232² < 2^53)
+for c in 1 2 3 4; do
+    awk -v C="$c" -v E="$DIR/charge$c" -v A="$DIR/attendu$c" '
+    function binaire(x,   s) {
+        if (x == 0) return "0"
+        s = ""
+        for (; x > 0; x = int(x / 2)) s = (x % 2) s
+        return s
+    }
+    function puissance(m, k,   r) {
+        for (r = 1; k > 0; k = int(k / 2)) {
+            if (k % 2) r = (r * m) % 3233
+            m = (m * m) % 3233
+        }
+        return r
+    }
+    BEGIN {
+        for (j = 1; j <= 2000; j++) {
+            m = (C * 7919 + j * 13) % 3233
+            if (j % 2) { print "rsa-enc 3 " binaire(m) > E; print binaire(puissance(m, 17)) > A }
+            else       { print "rsa-dec 3 " binaire(m) > E; print binaire(puissance(m, 2753)) > A }
+        }
+    }'
+done
+CLIENTS=
+for c in 1 2 3 4; do
+    "$CLIENT" -s "$DIR/sock" < "$DIR/charge$c" > "$DIR/sortie$c" 2>/dev/null &
+    CLIENTS="$CLIENTS $!"
+done
+for c in $CLIENTS; do wait "$c" || exit 1; done
+for c in 1 2 3 4; do
+    cmp "$DIR/attendu$c" "$DIR/sortie$c" || exit 1
+done
+
+# Clients tués en plein calcul : expmod sur 2048 bits, 50 par client
+M=$(head -c 256 /dev/urandom | od -An -tx1 | tr -d ' \n')
+awk -v M="$M" 'BEGIN { for (i = 0; i < 50; i++) print "expmod 0x" M " 0x" M " 0x" M "1" }' > "$DIR/lourd"
+CLIENTS=
+for c in 1 2 3 4; do
+    "$CLIENT" -s "$DIR/sock" < "$DIR/lourd" > /dev/null 2>&1 &
+    CLIENTS="$CLIENTS $!"
+done
+sleep 0.3
+kill -9 $CLIENTS 2>/dev/null
+for c in $CLIENTS; do wait "$c" 2>/dev/null; done
+
+"$CLIENT" -s "$DIR/sock" < "$DIR/requetes" > "$DIR/sortie" 2>/dev/null
+cmp "$DIR/attendu" "$DIR/sortie" || exit 1
+
+# Arrêt propre malgré les connexions disparues ; les requêtes RSA de même
+# clé ont été regroupées (moins de lots que de requêtes)
+kill "$PID"
+wait "$PID" || exit 1
+PID=
+awk '/requete\(s\),/ { vu = 1; ok = ($5 < $3) } END { exit !(vu && ok) }' "$DIR/journal" || exit 1
+exit 0